@@ -0,0 +1,122 @@
+#include "Anim.h"
+
+static struct
+{
+    const AnimClip * volatile clip;         // 0 while stopped
+    volatile uint8_t frame;
+    volatile uint16_t left;                 // Milliseconds left on the frame, 0 holds it
+    uint8_t node;                           // Scene node that shows the frames
+    int16_t x, y;
+} Animators[ANIMATORS];
+
+static volatile bool Changed = false;       // A frame changed since the last Anim_Update
+
+
+// Start clip on animator id, shown by scene node 'node' with the frame
+// offsets taken from x, y
+void Anim_Play(uint8_t id, const AnimClip *clip, uint8_t node, int16_t x, int16_t y)
+{
+    if(id >= ANIMATORS)
+        return;
+
+    Animators[id].clip = 0;                 // Anim_Tick skips it while it is set up
+    Animators[id].frame = 0;
+    Animators[id].left = clip->frames[0].ms;
+    Animators[id].node = node;
+    Animators[id].x = x;
+    Animators[id].y = y;
+    Animators[id].clip = clip;
+
+    Changed = true;
+}
+
+
+// The node keeps the frame it was showing
+void Anim_Stop(uint8_t id)
+{
+    if(id >= ANIMATORS)
+        return;
+
+    Animators[id].clip = 0;
+}
+
+
+void Anim_StopAll(void)
+{
+    uint8_t i;
+
+    for(i = 0; i < ANIMATORS; i = i + 1)
+        Animators[i].clip = 0;
+    Changed = false;
+}
+
+
+// True when Anim_Update would change a node
+bool Anim_Changed(void)
+{
+    return Changed;
+}
+
+
+// Give the nodes of the animators their current frames. A frame without a
+// sprite hides the node.
+void Anim_Update(void)
+{
+    const AnimClip *clip;
+    const AnimFrame *f;
+    uint8_t i, frame;
+
+    Changed = false;                        // Before reading the frames, a tick after this is not lost
+
+    for(i = 0; i < ANIMATORS; i = i + 1)
+    {
+        clip = Animators[i].clip;
+        if(!clip)
+            continue;
+
+        frame = Animators[i].frame;
+        if(frame >= clip->count)            // The tick moved on to the next clip in between
+            frame = 0;
+        f = &clip->frames[frame];
+
+        if(f->sprite)
+        {
+            Scene_SetSprite(Animators[i].node, f->sprite, f->mask);
+            Scene_Move(Animators[i].node, Animators[i].x + f->dx, Animators[i].y + f->dy);
+        }
+        Scene_Show(Animators[i].node, f->sprite != 0);
+    }
+}
+
+
+// Task of the scheduler, every millisecond
+void Anim_Tick(void)
+{
+    const AnimClip *clip;
+    uint8_t i;
+
+    for(i = 0; i < ANIMATORS; i = i + 1)
+    {
+        clip = Animators[i].clip;
+        if(!clip || !Animators[i].left)
+            continue;
+
+        Animators[i].left = Animators[i].left - 1;
+        if(Animators[i].left)
+            continue;
+
+        if(Animators[i].frame + 1 < clip->count)
+            Animators[i].frame = Animators[i].frame + 1;
+        else if(clip->next)
+        {
+            clip = clip->next;
+            Animators[i].clip = clip;
+            Animators[i].frame = 0;
+        }
+        else
+            continue;                       // Hold the last frame
+
+        Animators[i].left = clip->frames[Animators[i].frame].ms;
+        Changed = true;
+    }
+}
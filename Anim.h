@@ -0,0 +1,44 @@
+#ifndef ANIM_H_
+#define ANIM_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Nokia5110.h"
+#include "Scene.h"
+
+// Sprite animation. A clip is a list of frames in flash; an animator plays
+// one clip on a node of the scene (Scene.c). A 1 ms task of the scheduler
+// (Anim_Tick, Tick.c) moves the animators from frame to frame and never
+// touches the scene: the game asks Anim_Changed and, when it says so, calls
+// Anim_Update and renders the scene.
+
+// One frame: the sprite (with its mask, or 0 for none) drawn at dx, dy from
+// the animator's position, shown for ms milliseconds. A frame without a
+// sprite shows nothing, for blinking.
+typedef struct
+{
+    const Sprite *sprite;
+    const Sprite *mask;
+    int8_t dx;
+    int8_t dy;
+    uint16_t ms;
+} AnimFrame;
+
+typedef struct AnimClip
+{
+    const AnimFrame *frames;
+    uint8_t count;
+    const struct AnimClip *next;            // Played after the last frame: itself to loop, 0 to hold the last frame
+} AnimClip;
+
+#define ANIMATORS   4
+
+void Anim_Play      (uint8_t id, const AnimClip *clip, uint8_t node, int16_t x, int16_t y);
+void Anim_Stop      (uint8_t id);
+void Anim_StopAll   (void);
+bool Anim_Changed   (void);
+void Anim_Update    (void);
+void Anim_Tick      (void);
+
+#endif
@@ -1,4 +1,8 @@
 #include "Buttons.h"
+#include "Clock.h"
+#include "Profile.h"
+#include "Tick.h"
+#include "Replay.h"
 
 #include "inc/hw_gpio.h"
 #include "driverlib/gpio.h"
@@ -9,14 +13,55 @@
 #include "inc/hw_memmap.h"
 #include "inc/hw_types.h"
 
+#ifdef HOST_BUILD
+#include "host/Host.h"
+#define WRITE_REG(x)                      (*Host_Register(x))
+#else
 #define WRITE_REG(x)                      (*((volatile uint32_t *)(x)))
+#endif
+
+// Data register of a port as seen through the pins of a mask: reads return
+// only those pins and writes change only those pins
+#define GPIO_DATA(port, pins)             WRITE_REG((port) + GPIO_O_DATA + ((pins) << 2))
+
+#define COLUMNS                           (GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2 | GPIO_PIN_3)
+#define COLUMN_INTS                       (GPIO_INT_PIN_0 | GPIO_INT_PIN_1 | GPIO_INT_PIN_2 | GPIO_INT_PIN_3)
+
+// Time for a column to follow its row through the key and the pull-down of
+// the column pin before it is read, and the SysCtlDelay loops it takes at
+// the current clock
+#define BUTTON_SETTLE_US                  10
+#define BUTTON_SETTLE                     (ClockDelayPerMs * BUTTON_SETTLE_US / 1000)
+
+// Events from the keypad task to the game. Both run from the main loop, so
+// no lock is needed. Head and tail run free and wrap together, the queue
+// holds head - tail events.
+static ButtonEvent Events[BUTTON_EVENTS];
+static uint8_t EventHead = 0, EventTail = 0;
+
+static uint8_t HeldKey = BUTTON_NOT_PRESSED;           // Lowest key down
+static uint16_t Held = 0;                               // Keys down, debounced
+static uint32_t PressMs = 0;                            // Edge of the last press handed to the game
+static volatile bool Woken = false;                     // A column rose during Buttons_Sleep
+
+static ButtonTimings Timings = {BUTTON_DEBOUNCE_MS, BUTTON_HOLD_MS, BUTTON_REPEAT_MS, 0xFFFF};
+
+// Debounce and gesture state of each key, bit 4 * row + column
+static struct
+{
+    bool down;                              // Debounced level
+    uint16_t settle;                        // ms the scans have disagreed with it
+    uint32_t held;                          // ms down since the press, wraps after 49 days
+    uint32_t next;                          // held time of the next hold or repeat, 0 for none
+    uint32_t edge;                          // TickMs when the scans started to disagree
+} Keys[BUTTON_KEYS];
 
 void ConfigureButtons()
 {
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOB);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOF);
 
-    SysCtlDelay(SysCtlClockGet() / 4);
+    Clock_DelayMs(750);
 
     WRITE_REG(GPIO_PORTF_BASE + GPIO_O_LOCK) = GPIO_LOCK_KEY;
     WRITE_REG(GPIO_PORTF_BASE + GPIO_O_CR)   = 0x01;
@@ -28,69 +73,264 @@ void ConfigureButtons()
 
     GPIOPinTypeGPIOOutput(GPIO_PORTF_BASE, GPIO_PIN_4);
     GPIOPinTypeGPIOOutput(GPIO_PORTB_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_5); // Segmentation Fault aqui
+
+    // A column going high wakes the CPU from Buttons_Sleep, masked until then
+    GPIOIntTypeSet(GPIO_PORTF_BASE, COLUMNS, GPIO_RISING_EDGE);
+    GPIOIntClear(GPIO_PORTF_BASE, COLUMN_INTS);
+    IntEnable(INT_GPIOF);
 }
 
 
-uint8_t GetColumn()
+// Pin that drives each keypad row, top to bottom. A key joins its row to
+// its column.
+static const struct
+{
+    uint32_t port;
+    uint8_t pin;
+} Rows[4] =
+{
+    {GPIO_PORTF_BASE, GPIO_PIN_4},
+    {GPIO_PORTB_BASE, GPIO_PIN_0},
+    {GPIO_PORTB_BASE, GPIO_PIN_1},
+    {GPIO_PORTB_BASE, GPIO_PIN_5},
+};
+
+
+// All 16 keys in one pass, bit 4 * row + column (BUTTON_BIT). Each row is
+// driven high through its masked data address and PF0-PF3 are read in one
+// access, so several keys held at once are all seen. Without diodes in the
+// matrix, three keys on the corners of a rectangle also show the fourth.
+// Once Buttons_Tick is scanning, use Buttons_Held instead.
+uint16_t Buttons_Scan(void)
 {
-    if(GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_0) == GPIO_PIN_0)    return 1;
-    if(GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_1) == GPIO_PIN_1)    return 2;
-    if(GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_2) == GPIO_PIN_2)    return 3;
-    if(GPIOPinRead(GPIO_PORTF_BASE, GPIO_PIN_3) == GPIO_PIN_3)    return 4;
+    uint16_t keys = 0;
+    uint8_t row;
+
+    for(row = 0; row < 4; row++)
+    {
+        GPIO_DATA(Rows[row].port, Rows[row].pin) = 0xFF;
+        SysCtlDelay(BUTTON_SETTLE);
+        keys |= (GPIO_DATA(GPIO_PORTF_BASE, COLUMNS) & COLUMNS) << (4 * row);
+        GPIO_DATA(Rows[row].port, Rows[row].pin) = 0x00;
+    }
 
-    return 0;
+    return keys;
 }
 
 
+// Debounced key held at the last scan, the lowest one if several are, or
+// BUTTON_NOT_PRESSED
 uint8_t GetButton()
 {
-    uint8_t i;
-    uint8_t Column;
+    return HeldKey;
+}
 
-    for(i = 0; i < 4; i++)
+
+// Debounced keys held at the last scan, bit 4 * row + column
+uint16_t Buttons_Held(void)
+{
+    return Held;
+}
+
+
+// A full queue keeps its oldest events and drops the new one
+static void push(uint8_t key, uint8_t type, uint32_t ms)
+{
+    if((uint8_t)(EventHead - EventTail) == BUTTON_EVENTS)
+        return;
+
+    Events[EventHead % BUTTON_EVENTS].key = key;
+    Events[EventHead % BUTTON_EVENTS].type = type;
+    Events[EventHead % BUTTON_EVENTS].ms = ms;
+    EventHead = EventHead + 1;
+}
+
+
+// One scan of one key: press and release once the level has settled, hold
+// and repeat while it stays down
+static void step(uint8_t i, bool raw)
+{
+    uint8_t key = 10 * (i / 4 + 1) + i % 4 + 1;
+
+    if(raw != Keys[i].down)
     {
-        GPIOPinWrite(GPIO_PORTB_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_5 , 0x00);
-        GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_4, 0x00);
+        if(Keys[i].settle == 0)
+            Keys[i].edge = TickMs;
 
-        // Ativa, verifica e desliga cada linha
-        switch(i)
-        {
-            case 0:
-                GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_4 , 0xFF);
+        Keys[i].settle = Keys[i].settle + BUTTON_SCAN_MS;
+        if(Keys[i].settle < Timings.debounceMs)
+            return;
 
-                if((Column = GetColumn()) != 0)
-                    return (10 + Column);
+        Keys[i].down = raw;
+        Keys[i].settle = 0;
+        Keys[i].held = 0;
+        Keys[i].next = Timings.holdMs;
+        push(key, raw ? BUTTON_PRESS : BUTTON_RELEASE, Keys[i].edge);
+        return;
+    }
 
-                break;
+    Keys[i].settle = 0;
+    if(!Keys[i].down || !Keys[i].next)
+        return;
 
-            case 1:
-                GPIOPinWrite(GPIO_PORTB_BASE, GPIO_PIN_0 , 0xFF);
+    Keys[i].held = Keys[i].held + BUTTON_SCAN_MS;
+    if(Keys[i].held < Keys[i].next)
+        return;
 
-                if((Column = GetColumn()) != 0)
-                    return (20 + Column);
+    push(key, (Keys[i].next == Timings.holdMs) ? BUTTON_HOLD : BUTTON_REPEAT, TickMs);
 
-                break;
+    if(Timings.repeatMs && (Timings.repeatKeys & (1 << i)))
+        Keys[i].next = Keys[i].next + Timings.repeatMs;
+    else
+        Keys[i].next = 0;
+}
 
-            case 2:
-                GPIOPinWrite(GPIO_PORTB_BASE, GPIO_PIN_1 , 0xFF);
 
-                if((Column = GetColumn()) != 0)
-                    return (30 + Column);
+// Task of the scheduler (Tick.c), every BUTTON_SCAN_MS after
+// ConfigureButtons: scan and step the state of every key
+void Buttons_Tick(void)
+{
+    uint32_t start;
+    uint16_t raw, held = 0;
+    uint8_t i;
 
-                break;
+    start = Profile_Begin();
+    raw = Buttons_Scan();
+    Profile_End(PROFILE_KEYPAD, start);
 
-            case 3:
-                GPIOPinWrite(GPIO_PORTB_BASE, GPIO_PIN_5 , 0xFF);
+    raw = Replay_Keys(raw);                 // Recorded, or replaced by a replay
 
-                if((Column = GetColumn()) != 0)
-                    return (40 + Column);
+    HeldKey = BUTTON_NOT_PRESSED;
+    for(i = 0; i < BUTTON_KEYS; i++)
+    {
+        step(i, (raw >> i) & 1);
 
-                break;
+        if(Keys[i].down)
+        {
+            held |= 1 << i;
+            if(HeldKey == BUTTON_NOT_PRESSED)
+                HeldKey = 10 * (i / 4 + 1) + i % 4 + 1;
         }
     }
+    Held = held;
+}
+
+
+// Oldest event in the queue, false when it is empty
+bool Buttons_GetEvent(ButtonEvent *event)
+{
+    if(EventTail == EventHead)
+        return false;
+
+    event->key = Events[EventTail % BUTTON_EVENTS].key;
+    event->type = Events[EventTail % BUTTON_EVENTS].type;
+    event->ms = Events[EventTail % BUTTON_EVENTS].ms;
+    EventTail = EventTail + 1;
+    return true;
+}
 
-    GPIOPinWrite(GPIO_PORTB_BASE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_5 , 0x00);
-    GPIOPinWrite(GPIO_PORTF_BASE, GPIO_PIN_4, 0x00);
+
+// Key of the oldest press or repeat, skipping the other events, or
+// BUTTON_NOT_PRESSED
+uint8_t Buttons_GetPress(void)
+{
+    ButtonEvent event;
+
+    while(Buttons_GetEvent(&event))
+        if((event.type == BUTTON_PRESS) || (event.type == BUTTON_REPEAT))
+        {
+            PressMs = event.ms;
+            return event.key;
+        }
 
     return BUTTON_NOT_PRESSED;
 }
+
+
+// Key of the next press, waiting for it if the queue has none
+uint8_t Buttons_WaitPress(void)
+{
+    uint8_t key;
+
+    while((key = Buttons_GetPress()) == BUTTON_NOT_PRESSED)
+        Buttons_Sleep();
+
+    return key;
+}
+
+
+// Wait for the keypad, for loops with nothing else to do. While a key is
+// down or settling this is Tick_Wait, so the scans go on. Otherwise every
+// row is driven high, so that any key pulls its column up, and the CPU
+// sleeps with the scan held (Tick_Idle) until a column rises or TICK_IDLE_MS
+// pass. A replay has no keypad to wake it, so it keeps scanning.
+void Buttons_Sleep(void)
+{
+    uint8_t i;
+    bool idle;
+
+    if(Held || Replay_Playing())
+    {
+        Tick_Wait();
+        return;
+    }
+    for(i = 0; i < BUTTON_KEYS; i++)
+        if(Keys[i].settle)
+        {
+            Tick_Wait();
+            return;
+        }
+
+    for(i = 0; i < 4; i++)
+        GPIO_DATA(Rows[i].port, Rows[i].pin) = 0xFF;
+    SysCtlDelay(BUTTON_SETTLE);
+
+    // A key that went down since the last scan has no edge left to wake us
+    Woken = false;
+    GPIOIntClear(GPIO_PORTF_BASE, COLUMN_INTS);
+    GPIOIntEnable(GPIO_PORTF_BASE, COLUMN_INTS);
+    idle = !(GPIO_DATA(GPIO_PORTF_BASE, COLUMNS) & COLUMNS);
+    if(idle)
+        Tick_Idle(&Woken, TICK_IDLE_MS);
+    GPIOIntDisable(GPIO_PORTF_BASE, COLUMN_INTS);
+
+    // The scan drives one row at a time
+    for(i = 0; i < 4; i++)
+        GPIO_DATA(Rows[i].port, Rows[i].pin) = 0x00;
+
+    if(idle)
+        Tick_Run();
+    else
+        Tick_Wait();
+}
+
+
+// Keypad wake-up: the interrupt only has to end the sleep of Buttons_Sleep,
+// the scan that runs next reads the key
+void GPIOPortF_Handler(void)
+{
+    GPIOIntClear(GPIO_PORTF_BASE, COLUMN_INTS);
+    Woken = true;
+}
+
+
+// TickMs of the edge of the press (or repeat) that Buttons_GetPress or
+// Buttons_WaitPress returned last, for Latency_Input
+uint32_t Buttons_PressMs(void)
+{
+    return PressMs;
+}
+
+
+// Drop the queued events, such as presses made before a screen was shown
+void Buttons_Flush(void)
+{
+    EventTail = EventHead;
+}
+
+
+// Applies from the next press on. The hold must not be 0 for the repeats.
+void Buttons_SetTimings(const ButtonTimings *timings)
+{
+    Timings = *timings;
+}
@@ -6,7 +6,59 @@
 
 #define BUTTON_NOT_PRESSED (99)
 
+// The keypad is scanned by a task of the scheduler (Buttons_Tick, Tick.c)
+// every BUTTON_SCAN_MS. Each key is debounced on its own and its gestures are
+// queued as events, so a press made while the game is busy drawing or
+// waiting is not lost.
+#define BUTTON_SCAN_MS      5
+#define BUTTON_EVENTS       16              // Queue size, a power of two up to 128
+#define BUTTON_KEYS         16
+
+// Bit of a key code in a key bitmap, such as ButtonTimings.repeatKeys
+#define BUTTON_BIT(key)     (1 << (4 * ((key) / 10 - 1) + (key) % 10 - 1))
+
+// Default timings, in milliseconds
+#define BUTTON_DEBOUNCE_MS  15
+#define BUTTON_HOLD_MS      500
+#define BUTTON_REPEAT_MS    150
+
+enum buttonEventType
+{
+    BUTTON_PRESS,                           // Down for debounceMs
+    BUTTON_RELEASE,                         // Up for debounceMs
+    BUTTON_HOLD,                            // Still down holdMs after the press
+    BUTTON_REPEAT                           // Then every repeatMs, for the repeatKeys
+};
+
+typedef struct
+{
+    uint16_t debounceMs;                    // A key must stay up or down this long to count
+    uint16_t holdMs;                        // 0 for no BUTTON_HOLD
+    uint16_t repeatMs;                      // 0 for no BUTTON_REPEAT
+    uint16_t repeatKeys;                    // BUTTON_BIT of the keys that repeat
+} ButtonTimings;
+
+typedef struct
+{
+    uint8_t key;                            // 10 * row + column, 11 to 44
+    uint8_t type;                           // enum buttonEventType
+    uint32_t ms;                            // TickMs of the scan that saw the edge, before debouncing
+} ButtonEvent;
+
 void    ConfigureButtons();
 uint8_t GetButton();
 
+uint16_t Buttons_Scan       (void);
+uint16_t Buttons_Held       (void);
+
+bool    Buttons_GetEvent    (ButtonEvent *event);
+uint8_t Buttons_GetPress    (void);
+uint8_t Buttons_WaitPress   (void);
+void    Buttons_Sleep       (void);
+uint32_t Buttons_PressMs    (void);
+void    Buttons_Flush       (void);
+void    Buttons_SetTimings  (const ButtonTimings *timings);
+void    Buttons_Tick        (void);
+void    GPIOPortF_Handler   (void);
+
 #endif
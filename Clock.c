@@ -0,0 +1,42 @@
+#include "Clock.h"
+
+#include "driverlib/sysctl.h"
+
+uint32_t ClockHz = 16000000;
+uint32_t ClockTicksPerMs = 16000;
+uint32_t ClockDelayPerMs = 16000 / 3;
+
+// Rates are kept next to the SysCtlClockSet settings instead of asking
+// SysCtlClockGet, which gets the non-integer PLL divider (2.5) wrong on
+// older TivaWare releases.
+static const struct
+{
+    uint32_t config;
+    uint32_t hz;
+} Profiles[] =                              // In enum clockProfile order
+{
+    {SYSCTL_SYSDIV_1   | SYSCTL_USE_OSC | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ, 16000000},
+    {SYSCTL_SYSDIV_4   | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ, 50000000},
+    {SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_OSC_MAIN | SYSCTL_XTAL_16MHZ, 80000000},
+};
+
+
+// Set the core clock and cache the rates derived from it.
+// Call it once, first thing in main: the LCD, keypad and delay code read
+// the cached values when they are initialized.
+void Clock_Init(enum clockProfile profile)
+{
+    SysCtlClockSet(Profiles[profile].config);
+
+    ClockHz = Profiles[profile].hz;
+    ClockTicksPerMs = ClockHz / 1000;
+    ClockDelayPerMs = ClockTicksPerMs / 3;
+}
+
+
+// Busy-wait for ms milliseconds
+void Clock_DelayMs(uint32_t ms)
+{
+    if(ms)                                  // SysCtlDelay(0) would wrap around
+        SysCtlDelay(ClockDelayPerMs * ms);
+}
@@ -0,0 +1,23 @@
+#ifndef CLOCK_H_
+#define CLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Core clock settings, all from the 16 MHz crystal
+enum clockProfile
+{
+    CLOCK_16MHZ,                            // Crystal, no PLL
+    CLOCK_50MHZ,                            // PLL / 4
+    CLOCK_80MHZ                             // PLL / 2.5, fastest the TM4C123 runs
+};
+
+// Cached by Clock_Init; until then the chip runs from the 16 MHz internal oscillator
+extern uint32_t ClockHz;                    // System clock
+extern uint32_t ClockTicksPerMs;            // System clock cycles per millisecond (SysTick, DWT_CYCCNT)
+extern uint32_t ClockDelayPerMs;            // SysCtlDelay loops per millisecond (3 cycles each)
+
+void Clock_Init     (enum clockProfile profile);
+void Clock_DelayMs  (uint32_t ms);
+
+#endif
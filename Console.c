@@ -0,0 +1,72 @@
+#include "Console.h"
+#include "Clock.h"
+
+#include "inc/hw_memmap.h"
+#include "inc/hw_types.h"
+#include "driverlib/gpio.h"
+#include "driverlib/pin_map.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/uart.h"
+
+#define CONSOLE_BAUD    115200
+
+
+// PA0/PA1 are free: the LCD uses PA2, PA3 and PA5 to PA7.
+// Call after Clock_Init, the divisor comes from ClockHz.
+void Console_Init(void)
+{
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
+
+    GPIOPinConfigure(GPIO_PA0_U0RX);
+    GPIOPinConfigure(GPIO_PA1_U0TX);
+    GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+
+    UARTConfigSetExpClk(UART0_BASE, ClockHz, CONSOLE_BAUD,
+                        UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE);
+}
+
+
+// Newlines are sent as CR LF for terminal programs
+void Console_Write(const char *str)
+{
+    while(*str)
+    {
+        if(*str == '\n')
+            UARTCharPut(UART0_BASE, '\r');
+
+        UARTCharPut(UART0_BASE, *str);
+        str = str + 1;
+    }
+}
+
+
+// Unsigned decimal, right-justified in 'width' characters (0 for no padding)
+void Console_WriteUDec(uint32_t n, uint8_t width)
+{
+    char buffer[11];
+    int i = 10;
+
+    buffer[i] = 0;
+    do
+    {
+        i = i - 1;
+        buffer[i] = '0' + (n % 10);
+        n = n / 10;
+    } while(n);
+
+    while((10 - i) < width)
+    {
+        UARTCharPut(UART0_BASE, ' ');
+        width = width - 1;
+    }
+
+    Console_Write(&buffer[i]);
+}
+
+
+// Next received character, or -1 if there is none
+int16_t Console_Read(void)
+{
+    return UARTCharGetNonBlocking(UART0_BASE);
+}
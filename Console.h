@@ -0,0 +1,15 @@
+#ifndef CONSOLE_H_
+#define CONSOLE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Text console on UART0 (PA0/PA1), the virtual COM port of the LaunchPad debugger.
+// 115200 8N1, blocking writes, non-blocking reads.
+
+void    Console_Init        (void);
+void    Console_Write       (const char *str);
+void    Console_WriteUDec   (uint32_t n, uint8_t width);
+int16_t Console_Read        (void);
+
+#endif
@@ -0,0 +1,121 @@
+#include "Font.h"
+#include "Nokia5110.h"
+
+
+// Glyph of c and its length along the text
+const uint8_t *Font_Glyph(const Font *font, char c, uint8_t *length)
+{
+    uint8_t i = (uint8_t)c - font->first;
+
+    if(i >= font->count)                    // Below first wraps around too
+        i = 0;
+
+    if(font->stride)
+    {
+        *length = font->advance;
+        return font->data + i * font->stride;
+    }
+
+    *length = font->advances[i];
+    return font->data + font->offset[i];
+}
+
+
+// Draw c with the top left corner of its glyph at (x, y) and return how far
+// the next character goes along the text. Every pixel of the glyph cell is
+// set or cleared, like Nokia5110_DrawSprite, and clipped the same way.
+uint8_t Font_PrintChar(int16_t x, int16_t y, const Font *font, char c)
+{
+    Sprite glyph;
+    uint8_t length;
+
+    glyph.data = Font_Glyph(font, c, &length);
+    if((font->direction == FONT_DOWN) || (font->direction == FONT_UP))
+    {
+        glyph.width = font->thickness;
+        glyph.height = length;
+    }
+    else
+    {
+        glyph.width = length;
+        glyph.height = font->thickness;
+    }
+
+    Nokia5110_DrawSpriteMode(x, y, &glyph, BLIT_COPY);
+    return length;
+}
+
+
+// Length of str along the text, in pixels
+uint16_t Font_TextLength(const Font *font, const char *str)
+{
+    uint16_t total = 0;
+    uint8_t length;
+
+    if(font->stride)
+    {
+        while(*str)
+        {
+            total = total + font->advance;
+            str = str + 1;
+        }
+        return total;
+    }
+
+    while(*str)
+    {
+        Font_Glyph(font, *str, &length);
+        total = total + length;
+        str = str + 1;
+    }
+    return total;
+}
+
+
+// Draw str with (x, y) the top left corner of the rectangle it covers,
+// whichever way the font runs. There is no wrapping, like Nokia5110_PrintString.
+void Font_Print(int16_t x, int16_t y, const Font *font, const char *str)
+{
+    uint8_t length;
+
+    switch(font->direction)
+    {
+        case FONT_RIGHT:
+            while(*str)
+            {
+                x = x + Font_PrintChar(x, y, font, *str);
+                str = str + 1;
+            }
+            break;
+
+        case FONT_DOWN:
+            while(*str)
+            {
+                y = y + Font_PrintChar(x, y, font, *str);
+                str = str + 1;
+            }
+            break;
+
+        case FONT_LEFT:                     // The first character goes at the right end
+            x = x + Font_TextLength(font, str);
+            while(*str)
+            {
+                Font_Glyph(font, *str, &length);
+                x = x - length;
+                Font_PrintChar(x, y, font, *str);
+                str = str + 1;
+            }
+            break;
+
+        case FONT_UP:                       // The first character goes at the bottom
+            y = y + Font_TextLength(font, str);
+            while(*str)
+            {
+                Font_Glyph(font, *str, &length);
+                y = y - length;
+                Font_PrintChar(x, y, font, *str);
+                str = str + 1;
+            }
+            break;
+    }
+}
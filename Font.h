@@ -0,0 +1,38 @@
+#ifndef FONT_H_
+#define FONT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bitmap fonts drawn into the buffer like sprites. The tables are made by
+// tools/fontgen.py (fonts.c/fonts.h) with every glyph already turned for
+// the way its text runs, so any orientation is a plain table lookup.
+
+// Which way the text runs, which also tells how the glyphs are turned
+enum fontDirection
+{
+    FONT_RIGHT,                             // Left to right, upright
+    FONT_LEFT,                              // Right to left: upside down or mirrored
+    FONT_DOWN,                              // Top to bottom, turned 90 degrees clockwise
+    FONT_UP                                 // Bottom to top, turned 90 degrees counterclockwise
+};
+
+typedef struct
+{
+    uint8_t first;                          // First character in the tables
+    uint8_t count;                          // Characters in the tables, the others print as the first
+    uint8_t thickness;                      // Height of a line of text, width for FONT_DOWN and FONT_UP
+    uint8_t advance;                        // Glyph length along the text, 0 for a proportional font
+    uint8_t stride;                         // Bytes per glyph, 0 for a proportional font
+    enum fontDirection direction;
+    const uint8_t *data;                    // Glyphs, in banks like Sprite data
+    const uint16_t *offset;                 // Proportional font: where each glyph starts in data
+    const uint8_t *advances;                // Proportional font: length of each glyph along the text
+} Font;
+
+uint8_t  Font_PrintChar     (int16_t x, int16_t y, const Font *font, char c);
+void     Font_Print         (int16_t x, int16_t y, const Font *font, const char *str);
+uint16_t Font_TextLength    (const Font *font, const char *str);
+const uint8_t *Font_Glyph   (const Font *font, char c, uint8_t *length);
+
+#endif
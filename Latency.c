@@ -0,0 +1,96 @@
+#include "Latency.h"
+#include "Nokia5110.h"
+#include "Tick.h"
+
+static const char * const Names[LATENCY_INTERACTIONS] =
+{
+    "Title",
+    "MenuCursor",
+    "MenuConfirm",
+    "SkillCursor",
+    "SkillConfirm",
+};
+
+static LatencyStats Stats[LATENCY_INTERACTIONS];
+
+// The press waiting for its frame. A newer press replaces it: one frame
+// shows both, and the newer one is what the player looks for.
+static volatile bool Pending = false;
+static uint8_t PendingInteraction;
+static uint32_t PendingMs;
+static uint32_t PendingFrame;               // Nokia5110_FramesShown that puts it on the glass
+
+
+// Frame callback, from the SSI0 interrupt
+static void frameshown(void)
+{
+    LatencyStats *s;
+    uint32_t ms;
+
+    if(!Pending || ((int32_t)(Nokia5110_FramesShown() - PendingFrame) < 0))
+        return;
+
+    Pending = false;
+    s = &Stats[PendingInteraction];
+    ms = TickMs - PendingMs;
+
+    if((s->count == 0) || (ms < s->min))
+        s->min = ms;
+    if(ms > s->max)
+        s->max = ms;
+
+    s->total = s->total + ms;
+    s->count = s->count + 1;
+    s->buckets[(ms / LATENCY_BUCKET_MS < LATENCY_BUCKETS) ? (ms / LATENCY_BUCKET_MS) : (LATENCY_BUCKETS - 1)]++;
+}
+
+
+// Takes the frame callback of the driver
+void Latency_Init(void)
+{
+    Latency_Reset();
+    Nokia5110_SetFrameCallback(frameshown);
+}
+
+
+// Call when the game acts on a press, before it queues the frame that
+// answers it
+void Latency_Input(enum latencyInteraction interaction, uint32_t pressMs)
+{
+    Pending = false;                        // frameshown leaves it alone while it changes
+    PendingInteraction = interaction;
+    PendingMs = pressMs;
+    PendingFrame = Nokia5110_FramesQueued() + 1;
+    Pending = true;
+}
+
+
+void Latency_Reset(void)
+{
+    int i, b;
+
+    Pending = false;
+
+    for(i = 0; i < LATENCY_INTERACTIONS; i = i + 1)
+    {
+        Stats[i].count = 0;
+        Stats[i].min = 0;
+        Stats[i].max = 0;
+        Stats[i].total = 0;
+
+        for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+            Stats[i].buckets[b] = 0;
+    }
+}
+
+
+const LatencyStats *Latency_Stats(enum latencyInteraction interaction)
+{
+    return &Stats[interaction];
+}
+
+
+const char *Latency_Name(enum latencyInteraction interaction)
+{
+    return Names[interaction];
+}
@@ -0,0 +1,45 @@
+#ifndef LATENCY_H_
+#define LATENCY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Input-to-photon latency. The game tells Latency_Input which interaction a
+// press started and when its edge was seen (Buttons_PressMs). The next frame
+// it queues shows the answer; when the last byte of that frame reaches the
+// SSI (the frame callback of Nokia5110.c) the time since the edge goes into
+// the histogram of the interaction, in LATENCY_BUCKET_MS wide buckets.
+
+enum latencyInteraction
+{
+    LATENCY_TITLE,                          // Any key on the title, to the menu
+    LATENCY_MENU_CURSOR,                    // Cursor in the start menu
+    LATENCY_MENU_CONFIRM,                   // Confirm in the menu and the instructions, to the next screen
+    LATENCY_SKILL_CURSOR,                   // Cursor on the skills
+    LATENCY_SKILL_CONFIRM,                  // Skill chosen, to the choices of the round
+    LATENCY_INTERACTIONS
+};
+
+#define LATENCY_BUCKETS     8
+// The end of a frame is stamped when its last byte enters the SSI FIFO, so
+// up to 8 bytes behind it and the one shifting out are still to reach the
+// LCD. At the ~4 MHz SSI clock that is at most about 32 us, which the
+// histograms leave out: it is well under a bucket.
+#define LATENCY_BUCKET_MS   10              // The last bucket holds everything slower
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;                           // ms
+    uint32_t max;
+    uint32_t total;
+    uint32_t buckets[LATENCY_BUCKETS];
+} LatencyStats;
+
+void Latency_Init                   (void);
+void Latency_Input                  (enum latencyInteraction interaction, uint32_t pressMs);
+void Latency_Reset                  (void);
+const LatencyStats *Latency_Stats   (enum latencyInteraction interaction);
+const char *Latency_Name            (enum latencyInteraction interaction);
+
+#endif
@@ -0,0 +1,20 @@
+#include "Move.h"
+
+
+// Outcome of a round for the player. An id outside the set is a draw.
+MoveOutcome Move_Resolve(const MoveSet *set, uint8_t player, uint8_t oponent)
+{
+    static const MoveOutcome Draw = {MOVE_DRAW, 0};
+
+    if((player >= set->count) || (oponent >= set->count))
+        return Draw;
+
+    return set->outcomes[player * set->count + oponent];
+}
+
+
+// The opponent's move, from the seconds of the RTC
+uint8_t Move_Pick(const MoveSet *set, uint32_t seconds)
+{
+    return set->picks[seconds % 60];
+}
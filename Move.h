@@ -0,0 +1,45 @@
+#ifndef MOVE_H_
+#define MOVE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Nokia5110.h"
+
+// Move sets. A move is an id into its set, the set names the sprites of
+// each move. The outcome of every pair of moves is in a count x count table
+// made by tools/movegen.py (moves.c/moves.h), so a round is resolved with
+// one table load, whatever the size of the set.
+
+// For the player, as the rounds have always counted it
+enum moveResult
+{
+    MOVE_LOSE,
+    MOVE_WIN,
+    MOVE_DRAW
+};
+
+typedef struct
+{
+    uint8_t result;                         // enum moveResult
+    uint8_t damage;                         // HP the loser of the round loses, 0 for a draw
+} MoveOutcome;
+
+typedef struct
+{
+    const Sprite *icon;                     // On the skill bar
+    const Sprite *choice;                   // Shown when the move is chosen
+} Move;
+
+typedef struct
+{
+    uint8_t count;                          // Moves in the set, ids 0 to count - 1
+    const Move *moves;
+    const MoveOutcome *outcomes;            // Row: the player's move, column: the opponent's
+    const uint8_t *picks;                   // The opponent's move for each second of the RTC minute
+} MoveSet;
+
+MoveOutcome Move_Resolve    (const MoveSet *set, uint8_t player, uint8_t oponent);
+uint8_t Move_Pick           (const MoveSet *set, uint32_t seconds);
+
+#endif
@@ -1,78 +1,564 @@
 #include "Nokia5110.h"
 #include "Symbols.h"
+#include "Clock.h"
+#include "Profile.h"
+#include "fonts.h"
 
+#include <string.h>
 
-uint8_t Screen[SCREENW * SCREENH / 8]; // Buffer stores the next image to be printed on the screen
+
+// Two frames: everything draws into the back buffer (Screen) while the uDMA reads the front one
+static uint8_t FrameBuffers[2][FRAMEBYTES];
+uint8_t *Screen = FrameBuffers[0];                  // Buffer stores the next image to be printed on the screen
+static uint8_t *Front = FrameBuffers[1];            // Last presented frame
+
+static uint32_t FramePeriod = 0;                    // Minimum cycles between presented frames, 0 = unpaced
+static uint32_t LastFrame = 0;                      // DWT_CYCCNT_R when the last paced frame went out
+static uint32_t DroppedFrames = 0;                  // Nokia5110_Present calls refused
+
+// Drawing is limited to this rectangle, right and bottom edges excluded
+static int16_t ClipLeft = 0, ClipTop = 0, ClipRight = SCREENW, ClipBottom = SCREENH;
 const unsigned char Masks[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80}; // Utilizado na funo Nokia5110_ClrPxl
 
+// uDMA channel control table. The controller requires it to be 1024-byte aligned;
+// only the primary structures are used (channel 11 = SSI0 TX).
+#if defined(ccs)
+#pragma DATA_ALIGN(DMAControlTable, 1024)
+uint32_t DMAControlTable[128];
+#else
+uint32_t DMAControlTable[128] __attribute__ ((aligned(1024)));
+#endif
+
+static volatile bool FrameBusy = false;             // A flipped frame is still queued or being sent
+static Nokia5110_FrameCallback FrameCallback = 0;   // Optional notification, runs in the SSI0 interrupt
+static volatile uint32_t FramesQueued = 0;          // Frames handed to the queue, see frameend
+static volatile uint32_t FramesShown = 0;           // ... whose last byte has reached the SSI
+
+// Mirror of the PCD8544 RAM, so Nokia5110_DisplayBuffer only sends what differs from the glass.
+// Every data byte that goes to the LCD is recorded here, whatever function sent it.
+static uint8_t Glass[FRAMEBYTES];
+static bool GlassValid = false;                     // False until the whole panel has been written once
+static uint8_t GlassX = 0, GlassBank = 0;           // PCD8544 address pointer (horizontal addressing)
+
+// Columns [DirtyStart, DirtyEnd) of each bank may differ between Screen[] and Glass[]
+static uint8_t DirtyStart[SCREENBANKS] = {0, 0, 0, 0, 0, 0};
+static uint8_t DirtyEnd[SCREENBANKS] = {SCREENW, SCREENW, SCREENW, SCREENW, SCREENW, SCREENW};
+
+// Runs of bytes that must be sent to bring the glass up to date
+#define MAX_SPANS   16
+#define SPAN_GAP    4                               // Unchanged bytes cheaper to resend than to re-address
+static struct
+{
+    uint16_t start;                                 // Offset in the frame (bank * SCREENW + x)
+    uint16_t count;
+} Span[MAX_SPANS];
+
+// Transaction queue drained by the SSI0 interrupt. Consecutive bytes of the
+// same kind are coalesced into one run, so the DC line only changes between
+// runs, once the SSI has shifted out everything before it.
+#define QUEUE_BYTES 256                             // Power of two
+#define QUEUE_RUNS  64                              // Power of two
+enum runType
+{
+    RUN_COMMAND = COMMAND,                          // 'count' bytes of QueueBytes, DC low
+    RUN_DATA = DATA,                                // 'count' bytes of QueueBytes, DC high
+    RUN_BLOCK,                                      // 'count' bytes at 'ptr', sent by the uDMA, DC high
+    RUN_FRAMEEND                                    // End of a frame, 'count' 1 when flip queued it
+};
+static struct
+{
+    uint8_t type;
+    uint16_t count;
+    const uint8_t *ptr;
+} Runs[QUEUE_RUNS];
+static uint8_t QueueBytes[QUEUE_BYTES];
+static volatile uint32_t RunHead = 0, RunTail = 0;  // Free running, index with % QUEUE_RUNS
+static volatile uint32_t ByteHead = 0, ByteTail = 0;
+static volatile bool QueueIdle = true;              // No interrupt will come, new runs must start the drain
+static volatile bool BlockBusy = false;             // The uDMA is sending the run at RunHead
+static uint32_t DCLevel = 0xFFFFFFFF;               // Last value written to DC, unknown at first
+
 
 // ================== PRIVATE FUNCTIONS ==================
 
 
-// The Data/Command pin must be valid when the eighth bit is
-// sent. The SSI module has hardware input and output FIFOs
-// that are 8 locations deep. Based on the observation that
-// the LCD interface tends to send a few commands and then a
-// lot of data, the FIFOs are not used when writing
-// commands, and they are used when writing data.  This
-// ensures that the Data/Command pin status matches the byte
-// that is actually being transmitted.
-// The write command operation waits until all data has been
-// sent, configures the Data/Command pin for commands, sends
-// the command, and then waits for the transmission to
-// finish.
-// The write data operation waits until there is room in the
-// transmit FIFO, configures the Data/Command pin for data,
-// and then adds the data to the transmit FIFO.
-// This is a helper function that sends an 8-bit message to the LCD.
+void static lcddatawrite(uint8_t data);
+
+
+// Keep the SSI0 interrupt away while the queue is being changed. The barrier
+// makes sure the disable is in force before the queue is touched.
+#define QUEUE_LOCK()    do{ NVIC_DIS0_R = NVIC_EN0_SSI0; BARRIER(); }while(0)
+#define QUEUE_UNLOCK()  (NVIC_EN0_R = NVIC_EN0_SSI0)
+
+
+// Hand 'count' bytes starting at ptr to the SSI0 transmit FIFO.
+// The DC line must already be set; ptr must stay untouched until the frame is done.
+void static dmastart(const uint8_t *ptr, uint32_t count);
+
+
+// Move queued runs to the SSI until it has to wait: for room in the FIFO,
+// for the FIFO to drain before DC changes, or for the uDMA. The SSI0
+// interrupt calls it again when the wait is over.
+// Runs from SSI0_Handler or with the queue locked.
+void static lcdpump(void)
+{
+    uint32_t level;
+
+    while(RunHead != RunTail)
+    {
+        if(Runs[RunHead % QUEUE_RUNS].type == RUN_FRAMEEND)
+        {
+            // Only the end of a flip frees Front: the blocks before it read from it
+            if(Runs[RunHead % QUEUE_RUNS].count)
+                FrameBusy = false;
+            RunHead = RunHead + 1;
+            FramesShown = FramesShown + 1;
+
+            if(FrameCallback)
+                FrameCallback();
+
+            continue;
+        }
+
+        level = (Runs[RunHead % QUEUE_RUNS].type == RUN_COMMAND) ? DC_COMMAND : DC_DATA;
+        if(level != DCLevel)
+        {
+            // The Data/Command pin must be valid when the eighth bit of a byte is
+            // sent, so it only changes once the previous run is completely out
+            if((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY)
+            {
+                SSI0_CR1_R |= SSI_CR1_EOT;              // Interrupt when the last bit has gone
+                SSI0_IM_R |= SSI_IM_TXIM;
+                QueueIdle = false;
+                return;
+            }
+
+            DC = level;
+            DCLevel = level;
+        }
+
+        if(Runs[RunHead % QUEUE_RUNS].type == RUN_BLOCK)
+        {
+            if(!BlockBusy)
+            {
+                BlockBusy = true;
+                SSI0_IM_R &= ~SSI_IM_TXIM;              // The uDMA completion brings us back
+                dmastart(Runs[RunHead % QUEUE_RUNS].ptr, Runs[RunHead % QUEUE_RUNS].count);
+            }
+
+            QueueIdle = false;
+            return;
+        }
+
+        while(Runs[RunHead % QUEUE_RUNS].count && (SSI0_SR_R&SSI_SR_TNF))
+        {
+            SSI0_DR_R = QueueBytes[ByteHead % QUEUE_BYTES];
+            ByteHead = ByteHead + 1;
+            Runs[RunHead % QUEUE_RUNS].count = Runs[RunHead % QUEUE_RUNS].count - 1;
+        }
+
+        if(Runs[RunHead % QUEUE_RUNS].count)            // FIFO full
+        {
+            SSI0_CR1_R &= ~SSI_CR1_EOT;                 // Interrupt when the FIFO is half empty
+            SSI0_IM_R |= SSI_IM_TXIM;
+            QueueIdle = false;
+            return;
+        }
+
+        RunHead = RunHead + 1;
+    }
+
+    SSI0_IM_R &= ~SSI_IM_TXIM;
+    QueueIdle = true;
+}
+
+
+// Append a run to the queue and get the drain going if it had stopped.
+// Waits only when the queue is full.
+void static lcdqueuerun(uint8_t type, const uint8_t *ptr, uint16_t count)
+{
+    while((RunTail - RunHead) == QUEUE_RUNS){ SPINWAIT(); };
+
+    QUEUE_LOCK();
+    Runs[RunTail % QUEUE_RUNS].type = type;
+    Runs[RunTail % QUEUE_RUNS].count = count;
+    Runs[RunTail % QUEUE_RUNS].ptr = ptr;
+    RunTail = RunTail + 1;
+
+    if(QueueIdle)
+        lcdpump();
+    QUEUE_UNLOCK();
+}
+
+
+// Close a frame: the marker reaches the SSI0 interrupt once every byte queued
+// before it is in the FIFO, and counts the frame as shown there. flipped
+// marks the end of a frame sent by flip, the only one that ends FrameBusy.
+void static frameend(bool flipped)
+{
+    FramesQueued = FramesQueued + 1;
+    lcdqueuerun(RUN_FRAMEEND, 0, flipped ? 1 : 0);
+}
+
+
+// Queues an 8-bit message for the LCD and returns; the SSI0 interrupt sends
+// it. Waits only while the queue is full. A byte of the same kind as the
+// last queued one joins its run, otherwise a new run is started.
 // Inputs: type: COMMAND or DATA and message 8-bit code to transmit
 // Assumes: SSI0 and port A have already been initialized and enabled
 void static lcdwrite(enum typeOfWrite type, uint8_t message)
 {
-    if(type == COMMAND)
-    {
-        // Wait until SSI0 not busy/transmit FIFO empty
-        while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
-        DC = DC_COMMAND;
-        SSI0_DR_R = message; // Command out
+    uint32_t last;
+
+    while((ByteTail - ByteHead) == QUEUE_BYTES){ SPINWAIT(); };
+    while((RunTail - RunHead) == QUEUE_RUNS){ SPINWAIT(); };
+
+    QUEUE_LOCK();
+    QueueBytes[ByteTail % QUEUE_BYTES] = message;
+    ByteTail = ByteTail + 1;
 
-        // Wait until SSI0 not busy/transmit FIFO empty
-        while((SSI0_SR_R&SSI_SR_BSY)==SSI_SR_BSY){};
+    last = (RunTail - 1) % QUEUE_RUNS;
+    if((RunTail != RunHead) && (Runs[last].type == type))
+    {
+        Runs[last].count = Runs[last].count + 1;
     }
 
     else
     {
-        while((SSI0_SR_R&SSI_SR_TNF)==0){}; // Wait until transmit FIFO not full
-        DC = DC_DATA;
-        SSI0_DR_R = message;                // Data out
+        Runs[RunTail % QUEUE_RUNS].type = type;
+        Runs[RunTail % QUEUE_RUNS].count = 1;
+        RunTail = RunTail + 1;
     }
+
+    if(QueueIdle)
+        lcdpump();
+    QUEUE_UNLOCK();
+}
+
+
+// Record that columns [first, end) of a bank may no longer match the glass.
+void static markdirty(uint8_t bank, uint8_t first, uint8_t end)
+{
+    if(first < DirtyStart[bank]) DirtyStart[bank] = first;
+    if(end > DirtyEnd[bank])     DirtyEnd[bank] = end;
+}
+
+
+void static markall(void)
+{
+    int i;
+    for(i = 0; i < SCREENBANKS; i = i + 1)
+        markdirty(i, 0, SCREENW);
 }
 
 
 void static lcddatawrite(uint8_t data)
 {
-    while((SSI0_SR_R&0x00000002)==0){}; // Wait until transmit FIFO not full
+    lcdwrite(DATA, data);
+
+    // Keep the mirror in step with the PCD8544 address pointer
+    Glass[GlassBank * SCREENW + GlassX] = data;
+    markdirty(GlassBank, GlassX, GlassX + 1);
+
+    if(++GlassX == SCREENW)
+    {
+        GlassX = 0;
+        if(++GlassBank == SCREENBANKS) GlassBank = 0;
+    }
+}
+
+
+// Move the PCD8544 address pointer. x: 0 to 83, bank: 0 to 5
+void static lcdsetaddress(uint8_t x, uint8_t bank)
+{
+    lcdwrite(COMMAND, 0x80 | x);        // Setting bit 7 updates X-position
+    lcdwrite(COMMAND, 0x40 | bank);     // Setting bit 6 updates Y-position
 
-    DC = DC_DATA;
-    SSI0_DR_R = data;                   // Data out
+    GlassX = x;
+    GlassBank = bank;
+}
+
+
+// Compare the dirty part of 'frame' with the glass and build the list of runs
+// that must be sent. Glass[] is updated as if the runs had already been sent.
+// Runs separated by fewer than SPAN_GAP unchanged bytes are merged, since
+// re-addressing costs two commands and two FIFO drains.
+uint8_t static collectspans(const uint8_t *frame)
+{
+    int bank, i, end;
+    uint8_t n = 0;
+
+    if(!GlassValid)                     // Unknown panel content: send everything
+    {
+        for(i = 0; i < FRAMEBYTES; i = i + 1)
+            Glass[i] = frame[i];
+
+        Span[0].start = 0;
+        Span[0].count = FRAMEBYTES;
+        n = 1;
+        GlassValid = true;
+    }
+
+    else
+    {
+        for(bank = 0; bank < SCREENBANKS; bank = bank + 1)
+        {
+            end = bank * SCREENW + DirtyEnd[bank];
+
+            for(i = bank * SCREENW + DirtyStart[bank]; i < end; i = i + 1)
+            {
+                if(frame[i] == Glass[i])
+                    continue;
+
+                Glass[i] = frame[i];
+
+                if((n > 0) && ((n == MAX_SPANS) || (i - (Span[n-1].start + Span[n-1].count) <= SPAN_GAP)))
+                {
+                    Span[n-1].count = i + 1 - Span[n-1].start;  // Extend the previous run over the gap
+                }
+
+                else
+                {
+                    Span[n].start = i;
+                    Span[n].count = 1;
+                    n = n + 1;
+                }
+            }
+        }
+    }
+
+    for(bank = 0; bank < SCREENBANKS; bank = bank + 1)
+    {
+        DirtyStart[bank] = SCREENW;
+        DirtyEnd[bank] = 0;
+    }
+
+    return n;
+}
+
+
+// Route the SSI0 TX uDMA channel to a RAM buffer. The transfer
+// is started by dmastart() and finished by SSI0_Handler(), which also
+// serves the transaction queue.
+void static dmainit(void)
+{
+    SYSCTL_RCGCDMA_R |= SYSCTL_RCGCDMA_R0;          // Activate uDMA
+    (void)SYSCTL_RCGCDMA_R;                         // Allow time to finish activating
+
+    UDMA_CFG_R = UDMA_CFG_MASTEN;                   // Enable the controller
+    UDMA_CTLBASE_R = (uint32_t)DMAControlTable;
+
+    UDMA_CHMAP1_R &= ~UDMA_CHMAP1_CH11SEL_M;        // Channel 11 serves SSI0 TX
+    UDMA_PRIOCLR_R     = 1 << UDMA_CHANNEL_SSI0TX;  // Default priority
+    UDMA_ALTCLR_R      = 1 << UDMA_CHANNEL_SSI0TX;  // Primary control structure
+    UDMA_USEBURSTCLR_R = 1 << UDMA_CHANNEL_SSI0TX;  // Accept single and burst requests
+    UDMA_REQMASKCLR_R  = 1 << UDMA_CHANNEL_SSI0TX;  // Listen to the SSI requests
+
+    NVIC_EN0_R = NVIC_EN0_SSI0;                     // Completion is signalled on the SSI0 vector
+}
+
+
+void static dmastart(const uint8_t *ptr, uint32_t count)
+{
+    DMAControlTable[4 * UDMA_CHANNEL_SSI0TX + 0] = (uint32_t)&ptr[count - 1];   // Source end pointer
+    DMAControlTable[4 * UDMA_CHANNEL_SSI0TX + 1] = (uint32_t)&SSI0_DR_R;        // Destination end pointer
+    DMAControlTable[4 * UDMA_CHANNEL_SSI0TX + 2] = UDMA_CHCTL_DSTINC_NONE | UDMA_CHCTL_DSTSIZE_8 |
+                                                   UDMA_CHCTL_SRCINC_8 | UDMA_CHCTL_SRCSIZE_8 |
+                                                   UDMA_CHCTL_ARBSIZE_4 |
+                                                   ((count - 1) << UDMA_CHCTL_XFERSIZE_S) |
+                                                   UDMA_CHCTL_XFERMODE_BASIC;
+    SSI0_DMACTL_R |= SSI_DMACTL_TXDMAE;             // Let the SSI request transfers
+    UDMA_ENASET_R = 1 << UDMA_CHANNEL_SSI0TX;       // Go
+}
+
+
+// True if anything was drawn since the buffer was last sent.
+bool static anydirty(void)
+{
+    int i;
+    for(i = 0; i < SCREENBANKS; i = i + 1)
+        if(DirtyStart[i] < DirtyEnd[i])
+            return true;
+
+    return false;
+}
+
+
+// Page flip: the back buffer becomes the front one and its changed runs are
+// queued, each as an address and a block the uDMA reads from the front
+// buffer. The new back buffer begins as a copy of the presented frame, so
+// callers keep drawing incrementally on top of it.
+// Assumes no frame is in flight.
+void static flip(void)
+{
+    uint8_t *frame = Screen;
+    uint8_t n, k;
+    uint16_t end;
+    int i;
+
+    Screen = Front;
+    Front = frame;
+
+    n = collectspans(Front);
+
+    for(i = 0; i < FRAMEBYTES; i = i + 1)
+        Screen[i] = Front[i];
+
+    if(n == 0)                          // Nothing changed, the frame is shown when the queue gets there
+    {
+        frameend(false);
+        return;
+    }
+
+    FrameBusy = true;
+
+    for(k = 0; k < n; k = k + 1)
+    {
+        lcdsetaddress(Span[k].start % SCREENW, Span[k].start / SCREENW);
+        lcdqueuerun(RUN_BLOCK, &Front[Span[k].start], Span[k].count);
+
+        end = (Span[k].start + Span[k].count) % FRAMEBYTES;    // Where the address pointer ends up
+        GlassX = end % SCREENW;
+        GlassBank = end / SCREENW;
+    }
+
+    frameend(true);
+}
+
+
+// Replicate a byte in the four lanes of a word.
+#define LANES(b)    (0x01010101u * (uint8_t)(b))
+
+
+// Move the pixels of every byte lane of w 'shift' rows down inside the lane
+// (shift > 0) or -shift rows up (shift < 0). Shifting by s - 8 gives the rows
+// that fall out of the bottom of a lane shifted by s: the part that spills
+// into the next bank.
+uint32_t static shiftlanes(uint32_t w, int shift)
+{
+    if(shift > 0)
+        return (w << shift) & LANES(0xFF << shift);
+
+    if(shift < 0)
+        return (w >> -shift) & LANES(0xFF >> -shift);
+
+    return w;
+}
+
+
+// Combine one bank row of a sprite with the buffer, four columns per step.
+// cover: rows of the destination bank covered by the sprite (already shifted)
+// msk: optional mask in the sprite layout, only its set pixels are drawn
+void static blitrow(uint8_t *dst, const uint8_t *src, const uint8_t *msk, int width,
+                    int shift, uint8_t cover, enum blitMode mode)
+{
+    uint32_t d, v, m;
+    int i, n;
+
+    for(i = 0; i < width; i = i + n)
+    {
+        n = ((width - i) >= 4) ? 4 : 1;
+
+        d = 0; v = 0; m = 0xFFFFFFFF;
+        memcpy(&d, &dst[i], n);             // Unaligned word access, a single LDR on the Cortex-M4
+        memcpy(&v, &src[i], n);
+        if(msk)
+            memcpy(&m, &msk[i], n);
+
+        v = shiftlanes(v, shift);
+        m = shiftlanes(m, shift) & LANES(cover);
+
+        switch(mode)
+        {
+            case BLIT_COPY:     d = (d & ~m) | (v & m); break;
+            case BLIT_OR:       d = d | (v & m);        break;
+            case BLIT_ANDNOT:   d = d & ~(v & m);       break;
+            case BLIT_XOR:      d = d ^ (v & m);        break;
+        }
+
+        memcpy(&dst[i], &d, n);
+    }
+}
+
+
+// Draw 'height' rows of bank-packed pixels (see Sprite) into the buffer with
+// the top left corner at (x, y). When y is a multiple of 8 every source bank
+// lands on one buffer bank; otherwise it is shifted and split between the two
+// banks it straddles. msk may be 0.
+// The rectangle may be partly or completely outside the clip rectangle: only
+// the visible columns are read, and source banks with no visible row are
+// skipped.
+void static blit(int16_t x, int16_t y, uint8_t width, uint8_t height,
+                 const uint8_t *src, const uint8_t *msk, enum blitMode mode)
+{
+    int left = x, right = x + width, top = y, bottom = y + height;
+    int shift, first, bank, dbank, lo, hi;
+    uint8_t keep;
+    uint32_t start = Profile_Begin();
+
+    // Visible part of the rectangle
+    if(left < ClipLeft)
+        left = ClipLeft;
+    if(right > ClipRight)
+        right = ClipRight;
+    if(top < ClipTop)
+        top = ClipTop;
+    if(bottom > ClipBottom)
+        bottom = ClipBottom;
+    if((left >= right) || (top >= bottom))
+        return;
+
+    src = src + (left - x);             // Skip the columns on the left
+    if(msk)
+        msk = msk + (left - x);
+
+    shift = y & 0x07;                   // Also right for negative y (two's complement)
+    first = (top - y) >> 3;             // First source bank with a visible row
+
+    for(bank = first; (bank * 8) < (bottom - y); bank = bank + 1)
+    {
+        // Rows of this source bank that belong to the sprite and are visible
+        lo = top - y - bank * 8;
+        hi = bottom - y - bank * 8;
+        keep = (hi >= 8) ? 0xFF : ((1 << hi) - 1);
+        if(lo > 0)
+            keep = keep & ~((1 << lo) - 1);
+
+        dbank = ((y - shift) >> 3) + bank;  // Buffer bank of the source bank's top row
+
+        if((uint8_t)(keep << shift))        // Part that lands on the same bank
+        {
+            blitrow(&Screen[dbank * SCREENW + left], src + bank * width, msk ? (msk + bank * width) : 0,
+                    right - left, shift, keep << shift, mode);
+            markdirty(dbank, left, right);
+        }
+
+        if(shift && (keep >> (8 - shift)))  // Part that spills into the next bank
+        {
+            blitrow(&Screen[(dbank + 1) * SCREENW + left], src + bank * width, msk ? (msk + bank * width) : 0,
+                    right - left, shift - 8, keep >> (8 - shift), mode);
+            markdirty(dbank + 1, left, right);
+        }
+    }
+
+    Profile_End(PROFILE_DRAWSPRITE, start);
 }
 
 
 // =================== PUBLIC FUNCTIONS ===================
 
 
-// If the system clock is faster than 50 MHz, the SSI baud clock will be
-// faster than the 4 MHz maximum of the Nokia 5110.
-// Assumes: system clock rate of 50 MHz or less [.h] ???
-// Assumes: system clock rate of 80 MHz         [.c] ???
+// The SSI runs at the fastest rate the Nokia 5110 accepts (4 MHz) for the
+// system clock cached by Clock_Init, so call Clock_Init first.
 void Nokia5110_Init(void)
 {
     volatile uint32_t delay;
+    uint32_t cpsdvsr;
 
     SYSCTL_RCGC1_R |= SYSCTL_RCGC1_SSI0;  // Activate SSI0
     SYSCTL_RCGC2_R |= SYSCTL_RCGC2_GPIOA; // Activate port A
 
-    delay = SYSCTL_RCGC2_R;               // Allow time to finish activating
+    (void)SYSCTL_RCGC2_R;                 // Allow time to finish activating
 
     GPIO_PORTA_DIR_R |= 0xC0;             // Make PA6,7 out
     GPIO_PORTA_AFSEL_R |= 0x2C;           // Enable alt funct on PA2,3,5
@@ -89,11 +575,14 @@ void Nokia5110_Init(void)
 
     SSI0_CC_R = (SSI0_CC_R&~SSI_CC_CS_M)+SSI_CC_CS_SYSPLL; // Configure for system clock / PLL baud clock source
 
-    // Clock divider for 3.33 MHz SSIClk (80 MHz PLL / 24)
-    // SysClk/(CPSDVSR * (1 + SCR))
-    // 80 / (24 * (1 + 0)) = 3.33 MHz (slower than 4 MHz)
-    SSI0_CPSR_R = (SSI0_CPSR_R & ~SSI_CPSR_CPSDVSR_M) + 24; // Must be even number
-    SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0 (3.33 Mbps data rate)
+    // Clock divider for SSIClk = SysClk/(CPSDVSR * (1 + SCR)) <= 4 MHz
+    // 80 / (20 * (1 + 0)) = 4 MHz, 50 / (14 * (1 + 0)) = 3.57 MHz, 16 / (4 * (1 + 0)) = 4 MHz
+    cpsdvsr = (ClockHz + LCD_MAX_SSI_HZ - 1) / LCD_MAX_SSI_HZ;
+    cpsdvsr = (cpsdvsr + 1) & ~1;         // Must be even number
+    if(cpsdvsr < 2)
+        cpsdvsr = 2;
+    SSI0_CPSR_R = (SSI0_CPSR_R & ~SSI_CPSR_CPSDVSR_M) + cpsdvsr;
+    SSI0_CR0_R &= ~(SSI_CR0_SCR_M |       // SCR = 0
                     SSI_CR0_SPH |         // SPH = 0
                     SSI_CR0_SPO);         // SPO = 0
 
@@ -101,6 +590,8 @@ void Nokia5110_Init(void)
     SSI0_CR0_R = (SSI0_CR0_R & ~SSI_CR0_DSS_M) + SSI_CR0_DSS_8;    // DSS = 8-bit data
     SSI0_CR1_R |= SSI_CR1_SSE;                                     // Enable SSI
 
+    dmainit();                            // The queue and Nokia5110_DisplayBufferAsync run on the SSI0 interrupt
+
     RESET = RESET_LOW;                    // Reset the LCD to a known state
     for(delay=0; delay<10; delay=delay+1);// Delay minimum 100 ns
     RESET = RESET_HIGH;                   // Negative logic
@@ -123,13 +614,12 @@ void Nokia5110_Init(void)
 // either side of the character for readability.
 void Nokia5110_OutChar(char data)
 {
-    int i;
-    lcddatawrite(0x00); // Blank vertical line padding
-
-    for(i = 0; i < 5; i = i + 1)
-        lcddatawrite(ASCII[data - 0x20][i]);
+    const uint8_t *glyph;
+    uint8_t i, length;
 
-    lcddatawrite(0x00); // Blank vertical line padding
+    glyph = Font_Glyph(&Font_5x8, data, &length);   // Blank vertical line padding included
+    for(i = 0; i < length; i = i + 1)
+        lcddatawrite(glyph[i]);
 }
 
 
@@ -204,8 +694,7 @@ void Nokia5110_SetCursor(uint8_t newX, uint8_t newY)
         return;
 
     // Multiply newX by 7 because each character is 7 columns wide
-    lcdwrite(COMMAND, 0x80 | (newX * 7));   // Setting bit 7 updates X-position
-    lcdwrite(COMMAND, 0x40 | newY);         // Setting bit 6 updates Y-position
+    lcdsetaddress(newX * 7, newY);
 }
 
 
@@ -218,6 +707,9 @@ void Nokia5110_Clear(void)
     for(i = 0; i < (MAX_X * MAX_Y / 8); i = i + 1)
         lcddatawrite(0x00);
 
+    GlassValid = true;                  // Every byte of the panel is now known
+    frameend(false);
+
     Nokia5110_SetCursor(0, 0);
 }
 
@@ -232,6 +724,43 @@ void Nokia5110_DrawFullImage(const uint8_t *ptr)
 
     for(i = 0; i < (MAX_X * MAX_Y / 8); i = i + 1)
         lcddatawrite(ptr[i]);
+
+    GlassValid = true;                  // Every byte of the panel is now known
+    frameend(false);
+}
+
+
+// Fill the whole screen with an image packed by tools/rle_screens.py (see screens.h).
+// The runs are expanded straight into the SSI FIFO, without a 504 byte buffer:
+// 0x00-0x7F n: copy the next n + 1 bytes
+// 0x80-0xFF n: repeat the next byte (n - 0x80) + 3 times
+void Nokia5110_DrawCompressedImage(const uint8_t *ptr)
+{
+    int i = 0, n;
+    uint8_t code, data;
+
+    Nokia5110_SetCursor(0, 0);
+
+    while(i < FRAMEBYTES)
+    {
+        code = *ptr++;
+
+        if(code & 0x80)                 // Run
+        {
+            data = *ptr++;
+            for(n = code - 0x80 + 3; (n > 0) && (i < FRAMEBYTES); n = n - 1, i = i + 1)
+                lcddatawrite(data);
+        }
+
+        else                            // Literal bytes
+        {
+            for(n = code + 1; (n > 0) && (i < FRAMEBYTES); n = n - 1, i = i + 1)
+                lcddatawrite(*ptr++);
+        }
+    }
+
+    GlassValid = true;                  // Every byte of the panel is now known
+    frameend(false);
 }
 
 
@@ -247,6 +776,7 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
     int32_t width = ptr[18], height = ptr[22], i, j;
     uint16_t screenx, screeny;
     uint8_t mask;
+    uint32_t start;
 
     // Check for clipping
     if((height <= 0) ||                 // Bitmap is unexpectedly encoded in top-to-bottom pixel order
@@ -258,6 +788,8 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
         return;
     }
 
+    start = Profile_Begin();
+
     if(threshold > 14)
         threshold = 14;                 // Only full 'on' turns pixel on
 
@@ -267,6 +799,9 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
     screeny = ypos / 8;
     screenx = xpos + SCREENW*screeny;
 
+    for(i = (ypos - height + 1) / 8; (i <= ypos / 8) && (i < SCREENBANKS); i = i + 1)
+        markdirty(i, xpos, xpos + width);
+
     mask = ypos % 8;                // Row 0 to 7
     mask = 0x01 << mask;            // Now stores a mask 0x01 to 0x80
     j = ptr[10];                    // Byte 10 contains the offset where image data can be found
@@ -309,6 +844,71 @@ void Nokia5110_PrintBMP(uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t
             }
         }
     }
+
+    Profile_End(PROFILE_PRINTBMP, start);
+}
+
+
+// Copy a pre-converted sprite into the buffer with its top left corner at (x, y).
+// Every pixel of the sprite rectangle is set or cleared, like Nokia5110_PrintBMP.
+// x and y may be negative and the sprite may hang over the right and bottom
+// edges: only the part inside the clip rectangle (see Nokia5110_SetClip) is drawn.
+// The image will appear on the screen after the next call to Nokia5110_DisplayBuffer();
+void Nokia5110_DrawSprite(int16_t x, int16_t y, const Sprite *sprite)
+{
+    blit(x, y, sprite->width, sprite->height, sprite->data, 0, BLIT_COPY);
+}
+
+
+// Like Nokia5110_DrawSprite, with a different way of combining the sprite
+// with what is already in the buffer (see blitMode).
+void Nokia5110_DrawSpriteMode(int16_t x, int16_t y, const Sprite *sprite, enum blitMode mode)
+{
+    blit(x, y, sprite->width, sprite->height, sprite->data, 0, mode);
+}
+
+
+// Copy the pixels of the sprite that are set in mask, leave the others.
+// mask has the same size as the sprite (tools/bmp2sprite.py --mask).
+void Nokia5110_DrawSpriteMasked(int16_t x, int16_t y, const Sprite *sprite, const Sprite *mask)
+{
+    blit(x, y, sprite->width, sprite->height, sprite->data, mask->data, BLIT_COPY);
+}
+
+
+// Draw a character into the buffer with its top left corner at (x, y), any
+// pixel position. Like Nokia5110_OutChar, the 5 columns of the glyph get one
+// blank column on either side, so consecutive characters are 7 pixels apart.
+void Nokia5110_PrintChar(int16_t x, int16_t y, char data)
+{
+    Font_PrintChar(x, y, &Font_5x8, data);
+}
+
+
+// Draw a string into the buffer starting at pixel (x, y). There is no
+// wrapping: characters that do not fit in the row are cut at the clip edge.
+void Nokia5110_PrintString(int16_t x, int16_t y, const char *ptr)
+{
+    Font_Print(x, y, &Font_5x8, ptr);
+}
+
+
+// Limit the Draw and Print functions to the rectangle of width w and height h
+// with its top left corner at (x, y), e.g. a window or one half of the screen.
+// The rectangle is cut to the screen.
+void Nokia5110_SetClip(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    ClipLeft = (x < 0) ? 0 : x;
+    ClipTop = (y < 0) ? 0 : y;
+    ClipRight = ((x + w) > SCREENW) ? SCREENW : (x + w);
+    ClipBottom = ((y + h) > SCREENH) ? SCREENH : (y + h);
+}
+
+
+// Clip to the whole screen again
+void Nokia5110_ResetClip(void)
+{
+    Nokia5110_SetClip(0, 0, SCREENW, SCREENH);
 }
 
 
@@ -318,13 +918,232 @@ void Nokia5110_ClearBuffer(void)
     int i;
     for(i = 0; i < SCREENW * SCREENH / 8; i = i + 1)
         Screen[i] = 0;              // clear buffer
+
+    markall();
+}
+
+
+// Clear the pixels of the rectangle of width w and height h with its top left
+// corner at (x, y), cut to the clip rectangle.
+void Nokia5110_ClearRect(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int left = x, right = x + w, top = y, bottom = y + h;
+    int bank, lo, hi, i;
+    uint8_t keep;
+
+    if(left < ClipLeft)
+        left = ClipLeft;
+    if(right > ClipRight)
+        right = ClipRight;
+    if(top < ClipTop)
+        top = ClipTop;
+    if(bottom > ClipBottom)
+        bottom = ClipBottom;
+    if((left >= right) || (top >= bottom))
+        return;
+
+    for(bank = top >> 3; (bank * 8) < bottom; bank = bank + 1)
+    {
+        // Rows of this bank inside the rectangle
+        lo = (top > bank * 8) ? (top - bank * 8) : 0;
+        hi = (bottom < bank * 8 + 8) ? (bottom - bank * 8) : 8;
+        keep = ~(((1 << hi) - 1) & ~((1 << lo) - 1));
+
+        for(i = left; i < right; i = i + 1)
+            Screen[bank * SCREENW + i] &= keep;
+
+        markdirty(bank, left, right);
+    }
 }
 
 
-// Fill the whole screen by drawing a 48x84 screen image.
+// Bring the screen up to date with the buffer. Only the bytes that differ
+// from what is already on the glass are sent, each run preceded by its
+// X/Y address, so moving a small sprite costs a few bytes instead of 504.
+// The bytes are copied to the transaction queue; the function only waits
+// when the queue is full.
 void Nokia5110_DisplayBuffer(void)
 {
-    Nokia5110_DrawFullImage(Screen);
+    uint8_t n, k;
+    uint16_t i, end;
+    uint32_t start = Profile_Begin();
+
+    n = collectspans(Screen);
+
+    for(k = 0; k < n; k = k + 1)
+    {
+        lcdsetaddress(Span[k].start % SCREENW, Span[k].start / SCREENW);
+
+        end = Span[k].start + Span[k].count;
+        for(i = Span[k].start; i < end; i = i + 1)
+            lcddatawrite(Screen[i]);
+    }
+
+    for(k = 0; k < SCREENBANKS; k = k + 1) // What lcddatawrite marked is now on the glass
+    {
+        DirtyStart[k] = SCREENW;
+        DirtyEnd[k] = 0;
+    }
+    frameend(false);
+
+    Profile_End(PROFILE_DISPLAYBUFFER, start);
+}
+
+
+// Same as Nokia5110_DisplayBuffer, but the changed runs are moved by the uDMA
+// and the function returns as soon as they are queued; the SSI0 interrupt
+// addresses and starts them one after the other.
+// The buffers are flipped first, so drawing may resume immediately.
+// Waits only if the previous frame is still being sent.
+void Nokia5110_DisplayBufferAsync(void)
+{
+    Nokia5110_WaitFrameDone();            // Only one frame in flight
+    flip();
+}
+
+
+// Non-blocking version of Nokia5110_DisplayBufferAsync for game loops.
+// The frame is dropped (false is returned) when the previous one is still
+// being sent or when it comes earlier than the rate set by
+// Nokia5110_SetFrameRate; the drawing stays in the buffer and goes out with
+// a later call. Returns true when there was nothing new to show.
+bool Nokia5110_Present(void)
+{
+    uint32_t now, elapsed;
+
+    if(!anydirty())
+        return true;
+
+    if(FrameBusy)
+    {
+        DroppedFrames = DroppedFrames + 1;
+        return false;
+    }
+
+    if(FramePeriod)
+    {
+        now = DWT_CYCCNT_R;
+        elapsed = now - LastFrame;
+
+        if(elapsed < FramePeriod)
+        {
+            DroppedFrames = DroppedFrames + 1;
+            return false;
+        }
+
+        // Keep the cadence, unless we are more than a frame late
+        LastFrame = (elapsed < 2 * FramePeriod) ? (LastFrame + FramePeriod) : now;
+    }
+
+    PROFILE_ZONE(PROFILE_PRESENT)
+        flip();
+
+    return true;
+}
+
+
+// Limit Nokia5110_Present to 'fps' frames per second, 0 for no limit.
+// Uses the DWT cycle counter, so call it after the system clock is set.
+void Nokia5110_SetFrameRate(uint16_t fps)
+{
+    if(fps == 0)
+    {
+        FramePeriod = 0;
+        return;
+    }
+
+    CORE_DEMCR_R |= CORE_DEMCR_TRCENA;
+    DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+
+    FramePeriod = ClockHz / fps;
+    LastFrame = DWT_CYCCNT_R - FramePeriod;   // First frame may go at once
+}
+
+
+// Number of Nokia5110_Present calls that were refused.
+uint32_t Nokia5110_DroppedFrames(void)
+{
+    return DroppedFrames;
+}
+
+
+// True once the last asynchronous frame has been completely shifted out.
+bool Nokia5110_FrameDone(void)
+{
+    return (!FrameBusy) && ((SSI0_SR_R & SSI_SR_BSY) == 0);
+}
+
+
+// Block until the last asynchronous frame has been completely shifted out.
+void Nokia5110_WaitFrameDone(void)
+{
+    while(FrameBusy){ SPINWAIT(); };
+    while((SSI0_SR_R & SSI_SR_BSY) == SSI_SR_BSY){};
+}
+
+
+// Queue 'count' data bytes for column x of a bank, without waiting for them
+// to be sent (unless the queue is full). x: 0 to 83, bank: 0 to 5
+void Nokia5110_WriteAt(uint8_t x, uint8_t bank, const uint8_t *ptr, uint16_t count)
+{
+    lcdsetaddress(x, bank);
+
+    while(count)
+    {
+        lcddatawrite(*ptr++);
+        count = count - 1;
+    }
+}
+
+
+// Block until everything queued for the LCD has been shifted out.
+void Nokia5110_Flush(void)
+{
+    while(!QueueIdle){ SPINWAIT(); };
+    while((SSI0_SR_R & SSI_SR_BSY) == SSI_SR_BSY){};
+}
+
+
+// The callback is invoked from the SSI0 interrupt as soon as the last byte
+// of a frame has been handed to the SSI FIFO, for every frame sent by
+// Nokia5110_DisplayBuffer, Nokia5110_DisplayBufferAsync, Nokia5110_Present
+// or a full-screen image. Pass 0 to remove it.
+void Nokia5110_SetFrameCallback(Nokia5110_FrameCallback callback)
+{
+    FrameCallback = callback;
+}
+
+
+// Frames handed to the queue so far. The frame queued next is number
+// Nokia5110_FramesQueued() + 1.
+uint32_t Nokia5110_FramesQueued(void)
+{
+    return FramesQueued;
+}
+
+
+// Frames whose last byte has reached the SSI FIFO so far.
+uint32_t Nokia5110_FramesShown(void)
+{
+    return FramesShown;
+}
+
+
+// SSI0 interrupt: room in the transmit FIFO, end of transmission before a DC
+// change, or the end of a uDMA block (the uDMA reports it on the vector of
+// its peripheral). Either way the queue moves on.
+void SSI0_Handler(void)
+{
+    if(UDMA_CHIS_R & (1 << UDMA_CHANNEL_SSI0TX))
+    {
+        UDMA_CHIS_R = 1 << UDMA_CHANNEL_SSI0TX;     // Acknowledge
+        SSI0_DMACTL_R &= ~SSI_DMACTL_TXDMAE;
+
+        BlockBusy = false;
+        RunHead = RunHead + 1;                      // The block is in the FIFO
+    }
+
+    lcdpump();
 }
 
 
@@ -334,6 +1153,7 @@ void Nokia5110_DisplayBuffer(void)
 void Nokia5110_ClrPxl(uint32_t j, uint32_t i)
 {
     Screen[84 * (j >> 3) + i] &= ~Masks[j & 0x07];
+    markdirty(j >> 3, i, i + 1);
 }
 
 
@@ -343,10 +1163,12 @@ void Nokia5110_ClrPxl(uint32_t j, uint32_t i)
 void Nokia5110_SetPxl(uint32_t j, uint32_t i)
 {
     Screen[84 * (j >> 3) + i] |= Masks[j & 0x07];
+    markdirty(j >> 3, i, i + 1);
 }
 
 
 // Configure the system to get its clock from the PLL
+// Not used by the game, Clock_Init sets the clock and caches its rate.
 void PLL_Init(void)
 {
     // 0) Configure the system to use RCC2 for advanced features
@@ -431,31 +1253,24 @@ void Nokia5110_OutDec(uint16_t n)
 }
 
 
-// ???
+// Like Nokia5110_OutChar, upside down, from the turned glyphs of fonts.c
 void Nokia5110_OutCharInv(char data)
 {
-    int i;
-    lcddatawrite(0x00);        // Blank vertical line padding
-
-    for(i = 4; i > -1; i--)
-    {
-        char value = 0, j, aux = ASCII[data - 0x20][i];
-        for(j = 0; j < 8; j++) value |= (((aux & (0x80 >> j)) != 0) << j);
-        lcddatawrite(value);
-    }
+    const uint8_t *glyph;
+    uint8_t i, length;
 
-    lcddatawrite(0x00);        // Blank vertical line padding
+    glyph = Font_Glyph(&Font_5x8_Upside, data, &length);
+    for(i = 0; i < length; i = i + 1)
+        lcddatawrite(glyph[i]);
 }
 
 
-// ???
+// Upside-down text reads right to left: the last character is sent first
 void Nokia5110_OutStringInv(char *ptr)
 {
-    int i = 0;
-
-    while(ptr[i] != '\0') i++;
+    int i;
 
-    for(i--; i > -1; i--) Nokia5110_OutCharInv(ptr[i]);
+    for(i = strlen(ptr) - 1; i > -1; i--) Nokia5110_OutCharInv(ptr[i]);
 }
 
 
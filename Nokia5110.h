@@ -50,6 +50,26 @@
 
 
 
+// ======================== HOST BUILD ========================
+// With HOST_BUILD defined (see host/) the registers below are served by a
+// software model of the SSI, the uDMA and the PCD8544 instead of the chip.
+// SPINWAIT() goes in loops that wait for the SSI0 interrupt to change a
+// variable, so the model keeps running while the host spins. BARRIER()
+// waits until earlier register writes have taken effect; the model applies
+// them in order anyway.
+#ifdef HOST_BUILD
+#include "host/Host.h"
+#define REG32(addr)             (*Host_Register(addr))
+#define SPINWAIT()              Host_Run()
+#define BARRIER()
+#else
+#define REG32(addr)             (*((volatile uint32_t *)(addr)))
+#define SPINWAIT()
+#define BARRIER()               do{ __asm(" dsb"); __asm(" isb"); }while(0)
+#endif
+
+
+
 // ========================================================
 enum typeOfWrite
 {
@@ -71,29 +91,32 @@ enum typeOfWrite
 #define MAX_X                   84
 #define MAX_Y                   48
 #define CONTRAST                0xB7
+#define LCD_MAX_SSI_HZ          4000000     // PCD8544 serial clock limit
 #define SCREENW     84
 #define SCREENH     48
+#define SCREENBANKS (SCREENH / 8)           // Rows of 8 pixels addressed by the PCD8544 Y-address
+#define FRAMEBYTES  (SCREENW * SCREENH / 8)
 
 
 
 // ======================== DEFINES ========================
-#define DC                      (*((volatile uint32_t *)0x40004100))
+#define DC                      REG32(0x40004100)
 #define DC_COMMAND              0
 #define DC_DATA                 0x40
-#define RESET                   (*((volatile uint32_t *)0x40004200))
+#define RESET                   REG32(0x40004200)
 #define RESET_LOW               0
 #define RESET_HIGH              0x80
-#define GPIO_PORTA_DIR_R        (*((volatile uint32_t *)0x40004400))
-#define GPIO_PORTA_AFSEL_R      (*((volatile uint32_t *)0x40004420))
-#define GPIO_PORTA_DEN_R        (*((volatile uint32_t *)0x4000451C))
-#define GPIO_PORTA_AMSEL_R      (*((volatile uint32_t *)0x40004528))
-#define GPIO_PORTA_PCTL_R       (*((volatile uint32_t *)0x4000452C))
-#define SSI0_CR0_R              (*((volatile uint32_t *)0x40008000))
-#define SSI0_CR1_R              (*((volatile uint32_t *)0x40008004))
-#define SSI0_DR_R               (*((volatile uint32_t *)0x40008008))
-#define SSI0_SR_R               (*((volatile uint32_t *)0x4000800C))
-#define SSI0_CPSR_R             (*((volatile uint32_t *)0x40008010))
-#define SSI0_CC_R               (*((volatile uint32_t *)0x40008FC8))
+#define GPIO_PORTA_DIR_R        REG32(0x40004400)
+#define GPIO_PORTA_AFSEL_R      REG32(0x40004420)
+#define GPIO_PORTA_DEN_R        REG32(0x4000451C)
+#define GPIO_PORTA_AMSEL_R      REG32(0x40004528)
+#define GPIO_PORTA_PCTL_R       REG32(0x4000452C)
+#define SSI0_CR0_R              REG32(0x40008000)
+#define SSI0_CR1_R              REG32(0x40008004)
+#define SSI0_DR_R               REG32(0x40008008)
+#define SSI0_SR_R               REG32(0x4000800C)
+#define SSI0_CPSR_R             REG32(0x40008010)
+#define SSI0_CC_R               REG32(0x40008FC8)
 #define SSI_CR0_SCR_M           0x0000FF00  // SSI Serial Clock Rate
 #define SSI_CR0_SPH             0x00000080  // SSI Serial Clock Phase
 #define SSI_CR0_SPO             0x00000040  // SSI Serial Clock Polarity
@@ -103,27 +126,28 @@ enum typeOfWrite
 #define SSI_CR0_DSS_8           0x00000007  // 8-bit data
 #define SSI_CR1_MS              0x00000004  // SSI Master/Slave Select
 #define SSI_CR1_SSE             0x00000002  // SSI Synchronous Serial Port Enable
+#define SSI_CR1_EOT             0x00000010  // End of Transmission (TXIM when the last bit is out)
 #define SSI_SR_BSY              0x00000010  // SSI Busy Bit
 #define SSI_SR_TNF              0x00000002  // SSI Transmit FIFO Not Full
 #define SSI_CPSR_CPSDVSR_M      0x000000FF  // SSI Clock Prescale Divisor
 #define SSI_CC_CS_M             0x0000000F  // SSI Baud Clock Source
 #define SSI_CC_CS_SYSPLL        0x00000000  // Either the system clock (if the PLL bypass is in effect) or the PLL output (default)
-#define SYSCTL_RCGC1_R          (*((volatile uint32_t *)0x400FE104))
-#define SYSCTL_RCGC2_R          (*((volatile uint32_t *)0x400FE108))
+#define SYSCTL_RCGC1_R          REG32(0x400FE104)
+#define SYSCTL_RCGC2_R          REG32(0x400FE108)
 #define SYSCTL_RCGC1_SSI0       0x00000010  // SSI0 Clock Gating Control
 #define SYSCTL_RCGC2_GPIOA      0x00000001  // Port A Clock Gating Control
 
 
 
 // ======================== DEFINES PLL ======================== (Obs.: dif)
-#define SYSCTL_RIS_R            (*((volatile uint32_t *)0x400FE050))
+#define SYSCTL_RIS_R            REG32(0x400FE050)
 #define SYSCTL_RIS_PLLLRIS      0x00000040  // PLL Lock Raw Interrupt Status
-#define SYSCTL_RCC_R            (*((volatile uint32_t *)0x400FE060))
+#define SYSCTL_RCC_R            REG32(0x400FE060)
 #define SYSCTL_RCC_XTAL_M       0x000007C0  // Crystal Value
 #define SYSCTL_RCC_XTAL_6MHZ    0x000002C0  // 6 MHz Crystal
 #define SYSCTL_RCC_XTAL_8MHZ    0x00000380  // 8 MHz Crystal
 #define SYSCTL_RCC_XTAL_16MHZ   0x00000540  // 16 MHz Crystal
-#define SYSCTL_RCC2_R           (*((volatile uint32_t *)0x400FE070))
+#define SYSCTL_RCC2_R           REG32(0x400FE070)
 #define SYSCTL_RCC2_USERCC2     0x80000000  // Use RCC2
 #define SYSCTL_RCC2_DIV400      0x40000000  // Divide PLL as 400 MHz vs. 200 MHz
 #define SYSCTL_RCC2_SYSDIV2_M   0x1F800000  // System Clock Divisor 2
@@ -137,6 +161,47 @@ enum typeOfWrite
 
 
 
+// ======================== DEFINES uDMA ========================
+#define SSI0_IM_R               REG32(0x40008014)
+#define SSI_IM_TXIM             0x00000008  // SSI Transmit FIFO Interrupt Mask
+#define SSI0_DMACTL_R           REG32(0x40008024)
+#define SSI_DMACTL_TXDMAE       0x00000002  // Transmit DMA Enable
+#define SYSCTL_RCGCDMA_R        REG32(0x400FE60C)
+#define SYSCTL_RCGCDMA_R0       0x00000001  // uDMA Module Run Mode Clock Gating Control
+#define UDMA_CFG_R              REG32(0x400FF004)
+#define UDMA_CTLBASE_R          REG32(0x400FF008)
+#define UDMA_USEBURSTCLR_R      REG32(0x400FF01C)
+#define UDMA_REQMASKCLR_R       REG32(0x400FF024)
+#define UDMA_ENASET_R           REG32(0x400FF028)
+#define UDMA_ALTCLR_R           REG32(0x400FF034)
+#define UDMA_PRIOCLR_R          REG32(0x400FF03C)
+#define UDMA_CHIS_R             REG32(0x400FF504)
+#define UDMA_CHMAP1_R           REG32(0x400FF514)
+#define UDMA_CFG_MASTEN         0x00000001  // Controller Master Enable
+#define UDMA_CHMAP1_CH11SEL_M   0x0000F000  // uDMA Channel 11 Source Select (0 = SSI0 TX)
+#define UDMA_CHCTL_DSTINC_NONE  0xC0000000  // Destination address does not increment (SSI0_DR_R)
+#define UDMA_CHCTL_DSTSIZE_8    0x00000000  // Destination data size is 8 bits
+#define UDMA_CHCTL_SRCINC_8     0x00000000  // Source address increments by one byte
+#define UDMA_CHCTL_SRCSIZE_8    0x00000000  // Source data size is 8 bits
+#define UDMA_CHCTL_ARBSIZE_4    0x00008000  // Arbitrate after 4 transfers (half of the SSI FIFO)
+#define UDMA_CHCTL_XFERSIZE_S   4           // Transfer size field shift (size - 1)
+#define UDMA_CHCTL_XFERMODE_BASIC 0x00000001 // Basic transfer mode
+#define UDMA_CHANNEL_SSI0TX     11
+#define NVIC_EN0_R              REG32(0xE000E100)
+#define NVIC_DIS0_R             REG32(0xE000E180)
+#define NVIC_EN0_SSI0           0x00000080  // Interrupt 7: SSI0 (also signals uDMA completion)
+
+
+
+// ======================== DEFINES DWT ========================
+#define CORE_DEMCR_R            REG32(0xE000EDFC)
+#define CORE_DEMCR_TRCENA       0x01000000  // Enable DWT and ITM
+#define DWT_CTRL_R              REG32(0xE0001000)
+#define DWT_CTRL_CYCCNTENA      0x00000001  // Enable the cycle counter
+#define DWT_CYCCNT_R            REG32(0xE0001004)
+
+
+
 // =================== DEFINITIONS USED IN THE EXAMPLE ===================
 #define PIN_SCE   7 // Pin 3 on LCD
 #define PIN_RESET 6 // Pin 4 on LCD
@@ -149,6 +214,26 @@ enum typeOfWrite
 
 // ======================== FUNCTIONS PROTOTYPES ========================
 
+// Called from the SSI0 interrupt when a frame has been handed to the SSI
+typedef void (*Nokia5110_FrameCallback)(void);
+
+// How Nokia5110_DrawSpriteMode combines a sprite with the buffer
+enum blitMode
+{
+    BLIT_COPY,                            // Set and clear every pixel of the rectangle
+    BLIT_OR,                              // Set the sprite's pixels, the background shows through
+    BLIT_ANDNOT,                          // Clear the sprite's pixels (erase an OR-drawn sprite)
+    BLIT_XOR                              // Toggle the sprite's pixels, drawing twice restores the buffer
+};
+
+// 1bpp image in the LCD bank layout, generated by tools/bmp2sprite.py (see sprites.h).
+// data holds (height + 7) / 8 banks of 'width' bytes; bit 0 of each byte is the top row of its bank.
+typedef struct
+{
+    uint8_t width;
+    uint8_t height;
+    const uint8_t *data;
+} Sprite;
 
 void Nokia5110_Init             (void);
 void Nokia5110_OutChar          (char data);
@@ -158,15 +243,37 @@ void Nokia5110_OutDec           (uint16_t n);
 void Nokia5110_SetCursor        (uint8_t newX, uint8_t newY);
 void Nokia5110_Clear            (void);
 void Nokia5110_DrawFullImage    (const uint8_t *ptr);
+void Nokia5110_DrawCompressedImage (const uint8_t *ptr);
 void Nokia5110_PrintBMP         (uint8_t xpos, uint8_t ypos, const uint8_t *ptr, uint8_t threshold);
 void Nokia5110_ClearBuffer      (void);
+void Nokia5110_ClearRect        (int16_t x, int16_t y, int16_t w, int16_t h);
 void Nokia5110_DisplayBuffer    (void);
+void Nokia5110_DrawSprite       (int16_t x, int16_t y, const Sprite *sprite);
+void Nokia5110_DrawSpriteMode   (int16_t x, int16_t y, const Sprite *sprite, enum blitMode mode);
+void Nokia5110_DrawSpriteMasked (int16_t x, int16_t y, const Sprite *sprite, const Sprite *mask);
+void Nokia5110_PrintChar        (int16_t x, int16_t y, char data);
+void Nokia5110_PrintString      (int16_t x, int16_t y, const char *ptr);
+void Nokia5110_SetClip          (int16_t x, int16_t y, int16_t w, int16_t h);
+void Nokia5110_ResetClip        (void);
 void Nokia5110_ClrPxl           (uint32_t i, uint32_t j);
 void Nokia5110_SetPxl           (uint32_t j, uint32_t i);
 void Nokia5110_DrawMainCar      (const uint8_t *img, int x, int y);
 void Nokia5110_SetScreenPxl     (uint8_t *ptr, uint8_t data, int pos);
 void PLL_Init                   (void);
 
+void Nokia5110_DisplayBufferAsync   (void);
+bool Nokia5110_FrameDone            (void);
+void Nokia5110_WaitFrameDone        (void);
+void Nokia5110_SetFrameCallback     (Nokia5110_FrameCallback callback);
+uint32_t Nokia5110_FramesQueued     (void);
+uint32_t Nokia5110_FramesShown      (void);
+void Nokia5110_WriteAt              (uint8_t x, uint8_t bank, const uint8_t *ptr, uint16_t count);
+void Nokia5110_Flush                (void);
+bool Nokia5110_Present              (void);
+void Nokia5110_SetFrameRate         (uint16_t fps);
+uint32_t Nokia5110_DroppedFrames    (void);
+void SSI0_Handler                   (void);
+
 // void Nokia5110_DrawBlack         (void);
 // void Nokia5110_DrawFullImageInv  (const uint8_t *img);
 
@@ -0,0 +1,224 @@
+#include "Profile.h"
+
+#ifndef PROFILE_DISABLE
+
+#include "Nokia5110.h"
+#include "Clock.h"
+#include "Console.h"
+#include "Latency.h"
+#include "Replay.h"
+#include "State.h"
+#include "Tick.h"
+
+#include <string.h>
+
+static const char * const ZoneNames[PROFILE_ZONES] =
+{
+    "PrintBMP",
+    "DrawSprite",
+    "DisplayBuffer",
+    "Present",
+    "Keypad",
+    "FightFrame",
+};
+
+// Cycles per zone. Mean = total / count.
+static struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} Zones[PROFILE_ZONES];
+
+static uint32_t Overhead = 0;               // Cycles of an empty Begin/End pair
+
+
+// Start the cycle counter and the console, and measure the cost of the
+// profiler itself so it can be taken out of every sample.
+void Profile_Init(void)
+{
+    CORE_DEMCR_R |= CORE_DEMCR_TRCENA;
+    DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+
+    Console_Init();
+
+    Overhead = 0;
+    Profile_End(PROFILE_PRINTBMP, Profile_Begin());     // Any zone will do, the table is cleared below
+    Overhead = Zones[PROFILE_PRINTBMP].min;
+
+    Profile_Reset();
+}
+
+
+uint32_t Profile_Begin(void)
+{
+    return DWT_CYCCNT_R;
+}
+
+
+// Add one sample to the zone: the cycles since 'start', from Profile_Begin.
+void Profile_End(enum profileZone zone, uint32_t start)
+{
+    uint32_t cycles = DWT_CYCCNT_R - start;   // Right across a counter wrap
+
+    cycles = (cycles > Overhead) ? (cycles - Overhead) : 0;
+
+    if((Zones[zone].count == 0) || (cycles < Zones[zone].min))
+        Zones[zone].min = cycles;
+    if(cycles > Zones[zone].max)
+        Zones[zone].max = cycles;
+
+    Zones[zone].total = Zones[zone].total + cycles;
+    Zones[zone].count = Zones[zone].count + 1;
+}
+
+
+void Profile_Reset(void)
+{
+    int i;
+
+    for(i = 0; i < PROFILE_ZONES; i = i + 1)
+    {
+        Zones[i].count = 0;
+        Zones[i].min = 0;
+        Zones[i].max = 0;
+        Zones[i].total = 0;
+    }
+}
+
+
+// Print the table on the console, in cycles and in microseconds for the mean.
+void Profile_Dump(void)
+{
+    TickDuty duty;
+    uint32_t mean;
+    int i;
+
+    Console_Write("\nzone               count       min       max      mean   mean us\n");
+
+    for(i = 0; i < PROFILE_ZONES; i = i + 1)
+    {
+        mean = Zones[i].count ? (uint32_t)(Zones[i].total / Zones[i].count) : 0;
+
+        Console_Write(ZoneNames[i]);
+        Console_WriteUDec(Zones[i].count, 20 - strlen(ZoneNames[i]));
+        Console_WriteUDec(Zones[i].min, 10);
+        Console_WriteUDec(Zones[i].max, 10);
+        Console_WriteUDec(mean, 10);
+        Console_WriteUDec(mean / (ClockTicksPerMs / 1000), 10);
+        Console_Write("\n");
+    }
+
+    // The scheduler: periods its tasks missed and steps that overran
+    Console_Write("late task periods");
+    Console_WriteUDec(TickLate, 11);
+    Console_Write("\nstep overruns");
+    Console_WriteUDec(TickOverruns, 15);
+    Console_Write("\n");
+
+    // Duty cycle: ms awake and asleep (WFI) since the last reset
+    Tick_Duty(&duty);
+    Console_Write("awake ms");
+    Console_WriteUDec(duty.ms - duty.sleptMs, 20);
+    Console_Write("\nasleep ms");
+    Console_WriteUDec(duty.sleptMs, 19);
+    Console_Write("\nwake-ups");
+    Console_WriteUDec(duty.wakes, 20);
+    Console_Write("\nawake %");
+    Console_WriteUDec((duty.ms >= 100) ? ((duty.ms - duty.sleptMs) / (duty.ms / 100)) : 0, 21);  // Days of uptime fit
+    Console_Write("\n");
+}
+
+
+// Print the input-to-photon latency of each interaction (Latency.c): count,
+// min, max and mean in ms, then how many fell in each LATENCY_BUCKET_MS bucket.
+void Profile_DumpLatency(void)
+{
+    const LatencyStats *s;
+    int i, b;
+
+    Console_Write("\ninteraction    count  min  max mean");
+    for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+        Console_WriteUDec(b * LATENCY_BUCKET_MS, 5);
+    Console_Write(" ms\n");
+
+    for(i = 0; i < LATENCY_INTERACTIONS; i = i + 1)
+    {
+        s = Latency_Stats(i);
+
+        Console_Write(Latency_Name(i));
+        Console_WriteUDec(s->count, 20 - strlen(Latency_Name(i)));
+        Console_WriteUDec(s->min, 5);
+        Console_WriteUDec(s->max, 5);
+        Console_WriteUDec(s->count ? (s->total / s->count) : 0, 5);
+        for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+            Console_WriteUDec(s->buckets[b], 5);
+        Console_Write("\n");
+    }
+}
+
+
+// Print the timing of each state of the game flow (State.c): entries,
+// updates, ms spent in it, then the longest and the mean handler call in
+// cycles. The visit in progress counts in ms.
+void Profile_DumpStates(void)
+{
+    const StateStats *s;
+    uint32_t ms, calls;
+    int i;
+
+    Console_Write("\nstate            entries   updates        ms       max      mean\n");
+
+    for(i = 0; i < State_Count(); i = i + 1)
+    {
+        s = State_Stats(i);
+        ms = s->ms + ((i == State_Current()) ? State_Ms() : 0);
+        calls = s->entries + s->updates;
+
+        Console_Write(State_Name(i));
+        Console_WriteUDec(s->entries, 20 - strlen(State_Name(i)));
+        Console_WriteUDec(s->updates, 10);
+        Console_WriteUDec(ms, 10);
+        Console_WriteUDec(s->max, 10);
+        Console_WriteUDec(calls ? (uint32_t)(s->total / calls) : 0, 10);
+        Console_Write("\n");
+    }
+}
+
+
+// Console commands, call it from the main loops:
+// 'p' dumps the table, 'l' the latencies, 's' the states, 'x' the input
+// recording, 'r' clears the table, the latencies, the states and the duty
+// cycle.
+void Profile_Poll(void)
+{
+    switch(Console_Read())
+    {
+        case 'p':
+            Profile_Dump();
+            break;
+
+        case 'l':
+            Profile_DumpLatency();
+            break;
+
+        case 's':
+            Profile_DumpStates();
+            break;
+
+        case 'x':
+            Replay_Export();
+            break;
+
+        case 'r':
+            Profile_Reset();
+            Latency_Reset();
+            State_Reset();
+            Tick_DutyReset();
+            Console_Write("profile reset\n");
+            break;
+    }
+}
+
+#endif
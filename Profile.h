@@ -0,0 +1,51 @@
+#ifndef PROFILE_H_
+#define PROFILE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Cycle-accurate timing of code zones with the Cortex-M4 DWT cycle counter.
+// Build with PROFILE_DISABLE defined to compile the zones out.
+
+enum profileZone
+{
+    PROFILE_PRINTBMP,                       // Nokia5110_PrintBMP
+    PROFILE_DRAWSPRITE,                     // blit, behind every Draw and Print function
+    PROFILE_DISPLAYBUFFER,                  // Nokia5110_DisplayBuffer
+    PROFILE_PRESENT,                        // Nokia5110_Present that flips a frame
+    PROFILE_KEYPAD,                         // Keypad scan in Buttons_Tick
+    PROFILE_FIGHTFRAME,                     // Atualiza_Luta without its delay
+    PROFILE_ZONES
+};
+
+#ifndef PROFILE_DISABLE
+
+// Time the statement or block that follows. Leaving it with return, break
+// or goto skips the measurement; use Profile_Begin / Profile_End there.
+#define PROFILE_ZONE(zone)  for(uint32_t profile_start_ = Profile_Begin(), profile_once_ = 1; \
+                                profile_once_; profile_once_ = 0, Profile_End((zone), profile_start_))
+
+void     Profile_Init   (void);
+uint32_t Profile_Begin  (void);
+void     Profile_End    (enum profileZone zone, uint32_t start);
+void     Profile_Reset  (void);
+void     Profile_Dump   (void);
+void     Profile_DumpLatency (void);
+void     Profile_DumpStates  (void);
+void     Profile_Poll   (void);
+
+#else
+
+#define PROFILE_ZONE(zone)
+#define Profile_Init()
+#define Profile_Begin()         0
+#define Profile_End(zone, start) ((void)(start))
+#define Profile_Reset()
+#define Profile_Dump()
+#define Profile_DumpLatency()
+#define Profile_DumpStates()
+#define Profile_Poll()
+
+#endif
+
+#endif
@@ -0,0 +1,178 @@
+#include "Replay.h"
+#include "Tick.h"
+
+#ifndef HOST_BUILD
+#include "Console.h"
+#endif
+
+enum
+{
+    REPLAY_OFF,
+    REPLAY_RECORD,
+    REPLAY_PLAY
+};
+
+static volatile uint8_t Mode = REPLAY_OFF;
+
+static ReplayLog Recording;                 // In RAM, filled while recording
+static const ReplayLog *Log = &Recording;   // Read while playing
+static uint16_t NextKeys, NextSeed;         // Next entry of Log to play of each type
+static uint16_t Keys;                       // Bitmap recorded last, or played last
+
+
+// The log fills up and then keeps its beginning: a session is only
+// replayable from its start
+static void append(uint8_t type, uint32_t value)
+{
+    if(Recording.count == REPLAY_ENTRIES)
+    {
+        Recording.full = true;
+        return;
+    }
+
+    Recording.entries[Recording.count].ms = TickMs;
+    Recording.entries[Recording.count].value = value;
+    Recording.entries[Recording.count].type = type;
+    Recording.count = Recording.count + 1;
+}
+
+
+// Start a new recording, call it before ConfigureButtons. Does nothing
+// while a log is playing, so a replayed session is not recorded over.
+void Replay_Record(void)
+{
+    if(Mode == REPLAY_PLAY)
+        return;
+
+    Mode = REPLAY_OFF;
+    Recording.count = 0;
+    Recording.full = false;
+    Keys = 0;
+    Mode = REPLAY_RECORD;
+}
+
+
+// Play log from its start, call it before ConfigureButtons. The log must
+// stay in memory while it plays.
+void Replay_Play(const ReplayLog *log)
+{
+    Mode = REPLAY_OFF;
+    Log = log;
+    NextKeys = 0;
+    NextSeed = 0;
+    Keys = 0;
+    Mode = REPLAY_PLAY;
+}
+
+
+// Back to the live keypad and seeds, the recording stays readable
+void Replay_Stop(void)
+{
+    Mode = REPLAY_OFF;
+}
+
+
+bool Replay_Playing(void)
+{
+    return Mode == REPLAY_PLAY;
+}
+
+
+// From Buttons_Tick with the bitmap it scanned: logs it when it changed
+// while recording, and replaces it with the one the log holds at this
+// TickMs while playing
+uint16_t Replay_Keys(uint16_t scanned)
+{
+    if(Mode == REPLAY_RECORD)
+    {
+        if(scanned != Keys)
+            append(REPLAY_KEYS, scanned);
+        Keys = scanned;
+        return scanned;
+    }
+
+    if(Mode == REPLAY_PLAY)
+    {
+        for(; (NextKeys < Log->count) && ((int32_t)(TickMs - Log->entries[NextKeys].ms) >= 0); NextKeys++)
+            if(Log->entries[NextKeys].type == REPLAY_KEYS)
+                Keys = Log->entries[NextKeys].value;
+        return Keys;
+    }
+
+    return scanned;
+}
+
+
+// Seeds the game's randomness: live is logged while recording, and the
+// recorded seeds come back in order while playing. Past the last one the
+// live value is used.
+uint32_t Replay_Seed(uint32_t live)
+{
+    if(Mode == REPLAY_RECORD)
+        append(REPLAY_SEED, live);
+
+    if(Mode == REPLAY_PLAY)
+    {
+        while((NextSeed < Log->count) && (Log->entries[NextSeed].type != REPLAY_SEED))
+            NextSeed++;
+
+        if(NextSeed < Log->count)
+            return Log->entries[NextSeed++].value;
+    }
+
+    return live;
+}
+
+
+const ReplayLog *Replay_Log(void)
+{
+    return &Recording;
+}
+
+
+#ifndef HOST_BUILD
+
+// Print the log on the console in the text form above, which host/replay
+// reads. Copy it from the terminal into a file.
+void Replay_Export(void)
+{
+    const ReplayLog *log = Replay_Log();
+    int i;
+
+    Console_Write("\nreplay ");
+    Console_WriteUDec(log->count, 0);
+    Console_Write(log->full ? " full\n" : "\n");
+
+    for(i = 0; i < log->count; i = i + 1)
+    {
+        Console_Write((log->entries[i].type == REPLAY_KEYS) ? "k" : "s");
+        Console_WriteUDec(log->entries[i].ms, 11);
+        Console_WriteUDec(log->entries[i].value, 11);
+        Console_Write("\n");
+    }
+
+    Console_Write("end\n");
+}
+
+#ifdef PROFILE_DISABLE
+
+// Console command of a build without the profiler, call it from the main
+// loop: 'x' exports the log. The first call starts the console, which
+// Profile_Init would have started otherwise.
+void Replay_Poll(void)
+{
+    static bool started = false;
+
+    if(!started)
+    {
+        Console_Init();
+        started = true;
+    }
+
+    if(Console_Read() == 'x')
+        Replay_Export();
+}
+
+#endif
+
+#endif
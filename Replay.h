@@ -0,0 +1,62 @@
+#ifndef REPLAY_H_
+#define REPLAY_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Input recording and replay. While recording, every change of the raw
+// keypad bitmap that Buttons_Tick scans is logged with its TickMs, and so is
+// every random seed the game draws (Replay_Seed). While replaying, the keys
+// and the seeds come from a log instead, so a session runs again the same
+// way, on the device or in a host build (host/replay.c). Both start at boot:
+// TickMs is the time base of the log.
+//
+// The log is exported as text by 'x' on the console (Replay_Export), served
+// by Profile_Poll, or by Replay_Poll in a build without the profiler:
+//   replay <entries> [full]
+//   k <ms> <keys>               raw keypad bitmap from then on, decimal
+//   s <ms> <seed>               value returned by a Replay_Seed call
+//   end
+
+#define REPLAY_ENTRIES  256
+
+enum replayEntryType
+{
+    REPLAY_KEYS,
+    REPLAY_SEED
+};
+
+typedef struct
+{
+    uint32_t ms;                            // TickMs
+    uint32_t value;                         // Key bitmap or seed
+    uint8_t type;                           // enum replayEntryType
+} ReplayEntry;
+
+typedef struct
+{
+    uint16_t count;
+    bool full;                              // Entries were lost, the log cannot be replayed to the end
+    ReplayEntry entries[REPLAY_ENTRIES];
+} ReplayLog;
+
+void Replay_Record              (void);
+void Replay_Play                (const ReplayLog *log);
+void Replay_Stop                (void);
+bool Replay_Playing             (void);
+uint16_t Replay_Keys            (uint16_t scanned);
+uint32_t Replay_Seed            (uint32_t live);
+const ReplayLog *Replay_Log     (void);
+
+// The console is only on the device; the host tools write the log themselves
+#ifndef HOST_BUILD
+void Replay_Export              (void);
+#endif
+
+#if defined(PROFILE_DISABLE) && !defined(HOST_BUILD)
+void Replay_Poll                (void);
+#else
+#define Replay_Poll()                       // Profile_Poll serves 'x', or there is no console
+#endif
+
+#endif
@@ -0,0 +1,180 @@
+#include "Scene.h"
+
+static struct
+{
+    const Sprite *sprite;
+    const Sprite *mask;                     // 0 draws every pixel of the sprite rectangle
+    int16_t x, y;
+    uint8_t z;                              // Higher is drawn later, on top
+    bool visible;
+} Nodes[SCENE_NODES];
+
+static uint8_t Order[SCENE_NODES];          // Node ids by depth
+static bool Sorted = false;
+
+// Columns [start, end) of each bank that must be drawn again
+static uint8_t DirtyStart[SCREENBANKS] = {SCREENW, SCREENW, SCREENW, SCREENW, SCREENW, SCREENW};
+static uint8_t DirtyEnd[SCREENBANKS] = {0, 0, 0, 0, 0, 0};
+
+
+void static mark(int16_t x, int16_t y, uint8_t width, uint8_t height)
+{
+    int left = x, right = x + width, top = y, bottom = y + height, bank;
+
+    if(left < 0)
+        left = 0;
+    if(right > SCREENW)
+        right = SCREENW;
+    if(top < 0)
+        top = 0;
+    if(bottom > SCREENH)
+        bottom = SCREENH;
+    if((left >= right) || (top >= bottom))
+        return;
+
+    for(bank = top >> 3; (bank * 8) < bottom; bank = bank + 1)
+    {
+        if(left < DirtyStart[bank])  DirtyStart[bank] = left;
+        if(right > DirtyEnd[bank])   DirtyEnd[bank] = right;
+    }
+}
+
+
+// Mark what the node covers on the screen, if anything
+void static marknode(uint8_t id)
+{
+    if(Nodes[id].visible && Nodes[id].sprite)
+        mark(Nodes[id].x, Nodes[id].y, Nodes[id].sprite->width, Nodes[id].sprite->height);
+}
+
+
+// Insertion sort by depth, nodes of the same depth keep the order of their ids
+void static sort(void)
+{
+    uint8_t i, j, id;
+
+    for(i = 0; i < SCENE_NODES; i = i + 1)
+    {
+        id = i;
+        for(j = i; (j > 0) && (Nodes[Order[j - 1]].z > Nodes[id].z); j = j - 1)
+            Order[j] = Order[j - 1];
+        Order[j] = id;
+    }
+
+    Sorted = true;
+}
+
+
+// Empty scene: every node hidden, the whole screen is drawn (cleared) by the
+// next Scene_Render
+void Scene_Reset(void)
+{
+    uint8_t i;
+
+    for(i = 0; i < SCENE_NODES; i = i + 1)
+    {
+        Nodes[i].sprite = 0;
+        Nodes[i].visible = false;
+    }
+    mark(0, 0, SCREENW, SCREENH);
+}
+
+
+// Set up node id, visible, at (x, y) and depth z
+void Scene_Node(uint8_t id, const Sprite *sprite, const Sprite *mask, int16_t x, int16_t y, uint8_t z)
+{
+    if(id >= SCENE_NODES)
+        return;
+
+    marknode(id);
+    Nodes[id].sprite = sprite;
+    Nodes[id].mask = mask;
+    Nodes[id].x = x;
+    Nodes[id].y = y;
+    Nodes[id].z = z;
+    Nodes[id].visible = true;
+    marknode(id);
+
+    Sorted = false;
+}
+
+
+void Scene_SetSprite(uint8_t id, const Sprite *sprite, const Sprite *mask)
+{
+    if((id >= SCENE_NODES) || ((Nodes[id].sprite == sprite) && (Nodes[id].mask == mask)))
+        return;
+
+    marknode(id);
+    Nodes[id].sprite = sprite;
+    Nodes[id].mask = mask;
+    marknode(id);
+}
+
+
+void Scene_Move(uint8_t id, int16_t x, int16_t y)
+{
+    if((id >= SCENE_NODES) || ((Nodes[id].x == x) && (Nodes[id].y == y)))
+        return;
+
+    marknode(id);
+    Nodes[id].x = x;
+    Nodes[id].y = y;
+    marknode(id);
+}
+
+
+void Scene_Show(uint8_t id, bool visible)
+{
+    if((id >= SCENE_NODES) || (Nodes[id].visible == visible))
+        return;
+
+    marknode(id);                           // Covers the node when it is hidden
+    Nodes[id].visible = visible;
+    marknode(id);                           // ... and when it is shown
+}
+
+
+// Draw again the parts of the buffer that changed since the last call, one
+// bank at a time: cleared, then every visible node that overlaps it, clipped.
+// The clip rectangle is reset to the whole screen afterwards.
+void Scene_Render(void)
+{
+    uint8_t bank, i, id;
+    int16_t left, right, top;
+
+    if(!Sorted)
+        sort();
+
+    for(bank = 0; bank < SCREENBANKS; bank = bank + 1)
+    {
+        left = DirtyStart[bank];
+        right = DirtyEnd[bank];
+        if(left >= right)
+            continue;
+
+        top = bank * 8;
+        Nokia5110_SetClip(left, top, right - left, 8);
+        Nokia5110_ClearRect(left, top, right - left, 8);
+
+        for(i = 0; i < SCENE_NODES; i = i + 1)
+        {
+            id = Order[i];
+            if(!Nodes[id].visible || !Nodes[id].sprite)
+                continue;
+
+            if((Nodes[id].x >= right) || (Nodes[id].x + Nodes[id].sprite->width <= left) ||
+               (Nodes[id].y >= top + 8) || (Nodes[id].y + Nodes[id].sprite->height <= top))
+                continue;
+
+            if(Nodes[id].mask)
+                Nokia5110_DrawSpriteMasked(Nodes[id].x, Nodes[id].y, Nodes[id].sprite, Nodes[id].mask);
+            else
+                Nokia5110_DrawSprite(Nodes[id].x, Nodes[id].y, Nodes[id].sprite);
+        }
+
+        DirtyStart[bank] = SCREENW;
+        DirtyEnd[bank] = 0;
+    }
+
+    Nokia5110_ResetClip();
+}
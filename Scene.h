@@ -0,0 +1,26 @@
+#ifndef SCENE_H_
+#define SCENE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "Nokia5110.h"
+
+// Retained scene: the screen is a list of sprite nodes, each with a
+// position, a depth and a visibility. Changing a node only records which
+// banks it covered and now covers; Scene_Render redraws those parts of the
+// buffer, every node that overlaps them in depth order, and leaves the rest
+// untouched. Send the buffer as usual afterwards (Nokia5110_Present, ...).
+//
+// Nodes are numbered by the caller, 0 to SCENE_NODES - 1.
+
+#define SCENE_NODES     16
+
+void Scene_Reset        (void);
+void Scene_Node         (uint8_t id, const Sprite *sprite, const Sprite *mask, int16_t x, int16_t y, uint8_t z);
+void Scene_SetSprite    (uint8_t id, const Sprite *sprite, const Sprite *mask);
+void Scene_Move         (uint8_t id, int16_t x, int16_t y);
+void Scene_Show         (uint8_t id, bool visible);
+void Scene_Render       (void);
+
+#endif
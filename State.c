@@ -0,0 +1,136 @@
+#include "State.h"
+#include "Nokia5110.h"
+#include "Tick.h"
+
+static const StateDef *States = 0;
+static uint8_t Count = 0;
+static uint8_t Current = STATE_NONE;
+static uint8_t Next = STATE_NONE;
+static uint32_t EnteredMs = 0;              // TickMs when Current was entered
+
+static StateStats Stats[STATE_MAX];
+
+
+// Run one handler of the current state and add its cycles to the state
+static void call(void (*handler)(void))
+{
+    uint32_t start, cycles;
+
+    if(!handler)
+        return;
+
+    start = DWT_CYCCNT_R;
+    handler();
+    cycles = DWT_CYCCNT_R - start;          // Right across a counter wrap
+
+    if(cycles > Stats[Current].max)
+        Stats[Current].max = cycles;
+    Stats[Current].total = Stats[Current].total + cycles;
+}
+
+
+// The first State_Update enters first. The table stays in use, keep it in
+// flash.
+void State_Init(const StateDef *states, uint8_t count, uint8_t first)
+{
+    // call() times the handlers with the cycle counter, whoever else uses it
+    CORE_DEMCR_R |= CORE_DEMCR_TRCENA;
+    DWT_CTRL_R |= DWT_CTRL_CYCCNTENA;
+
+    States = states;
+    Count = (count < STATE_MAX) ? count : STATE_MAX;
+    Current = STATE_NONE;
+    Next = first;
+    State_Reset();
+}
+
+
+// Leave the current state for next once the running handler returns. The
+// last call before then wins.
+void State_Go(uint8_t next)
+{
+    if(next < Count)
+        Next = next;
+}
+
+
+// One pass of the main loop: update the state, then change state if a
+// handler asked for it
+void State_Update(void)
+{
+    if(Current != STATE_NONE)
+    {
+        Stats[Current].updates = Stats[Current].updates + 1;
+        call(States[Current].update);
+    }
+
+    if(Next == STATE_NONE)
+        return;
+
+    if(Current != STATE_NONE)
+    {
+        call(States[Current].exit);
+        Stats[Current].ms = Stats[Current].ms + (TickMs - EnteredMs);
+    }
+
+    Current = Next;
+    Next = STATE_NONE;
+    EnteredMs = TickMs;
+    Stats[Current].entries = Stats[Current].entries + 1;
+    call(States[Current].enter);
+}
+
+
+uint8_t State_Current(void)
+{
+    return Current;
+}
+
+
+// The current state only waits for keys and no change is pending
+bool State_Sleeps(void)
+{
+    return (Current != STATE_NONE) && (Next == STATE_NONE) && States[Current].sleeps;
+}
+
+
+// ms since the current state was entered
+uint32_t State_Ms(void)
+{
+    return TickMs - EnteredMs;
+}
+
+
+uint8_t State_Count(void)
+{
+    return Count;
+}
+
+
+const char *State_Name(uint8_t state)
+{
+    return (state < Count) ? States[state].name : "";
+}
+
+
+const StateStats *State_Stats(uint8_t state)
+{
+    return &Stats[(state < STATE_MAX) ? state : 0];
+}
+
+
+// The visit of the current state counts from now on
+void State_Reset(void)
+{
+    uint8_t i;
+
+    for(i = 0; i < STATE_MAX; i++)
+    {
+        Stats[i].entries = 0;
+        Stats[i].updates = 0;
+        Stats[i].ms = 0;
+        Stats[i].max = 0;
+        Stats[i].total = 0;
+    }
+    EnteredMs = TickMs;
+}
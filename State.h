@@ -0,0 +1,49 @@
+#ifndef STATE_H_
+#define STATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// State machine of the game flow. Each state has handlers that return at
+// once: enter when the state starts, update on every pass of the main loop
+// while it lasts, exit when it ends. Any of them may be 0. A handler asks
+// for the next state with State_Go; State_Update makes the change once the
+// handler has returned, so the state never changes under a running one.
+//
+// Every state keeps its timing: how often it was entered and updated, the
+// ms spent in it and the cycles its handlers took (DWT).
+
+#define STATE_MAX   8                       // States in a table, at most
+#define STATE_NONE  0xFF
+
+typedef struct
+{
+    const char *name;
+    void (*enter)(void);
+    void (*update)(void);
+    void (*exit)(void);
+    bool sleeps;                            // Only waits for keys: the main loop may sleep between updates
+} StateDef;
+
+typedef struct
+{
+    uint32_t entries;
+    uint32_t updates;
+    uint32_t ms;                            // In the state, up to its last exit
+    uint32_t max;                           // Cycles of the longest handler call
+    uint64_t total;                         // Cycles of all its handler calls
+} StateStats;
+
+void State_Init                 (const StateDef *states, uint8_t count, uint8_t first);
+void State_Go                   (uint8_t next);
+void State_Update               (void);
+uint8_t State_Current           (void);
+bool State_Sleeps               (void);
+uint32_t State_Ms               (void);
+
+uint8_t State_Count             (void);
+const char *State_Name          (uint8_t state);
+const StateStats *State_Stats   (uint8_t state);
+void State_Reset                (void);
+
+#endif
@@ -0,0 +1,213 @@
+#include "Tick.h"
+#include "Clock.h"
+
+#include "driverlib/cpu.h"
+#include "driverlib/systick.h"
+
+volatile uint32_t TickMs = 0;
+uint32_t TickLate = 0;
+uint32_t TickOverruns = 0;
+
+// Time spent in WFI since Tick_DutyReset: whole ms, and the cycles short of
+// the next one
+static TickDuty Duty;
+static uint32_t DutyStart = 0;
+static uint32_t SleepCycles = 0;
+
+static struct
+{
+    TickTask task;
+    uint16_t period;
+    uint32_t next;                          // TickMs it is due at
+} Tasks[TICK_TASKS];
+static uint8_t TaskCount = 0;
+
+
+// Call after Clock_Init, the period comes from ClockTicksPerMs
+void Tick_Init(void)
+{
+    SysTickPeriodSet(ClockTicksPerMs);
+    SysTickIntEnable();
+    SysTickEnable();
+}
+
+
+// Run task every periodMs from now on, in the order the tasks were added.
+// False, and the task never runs, when TICK_TASKS are already added.
+bool Tick_Every(TickTask task, uint16_t periodMs)
+{
+    if(TaskCount == TICK_TASKS)
+        return false;
+
+    Tasks[TaskCount].task = task;
+    Tasks[TaskCount].period = periodMs;
+    Tasks[TaskCount].next = TickMs + periodMs;
+    TaskCount = TaskCount + 1;
+    return true;
+}
+
+
+// Run the tasks that are due. A task that missed periods runs once and
+// keeps its cadence; the periods it missed are counted in TickLate.
+void Tick_Run(void)
+{
+    uint32_t now = TickMs;
+    uint8_t i;
+
+    for(i = 0; i < TaskCount; i++)
+    {
+        if((int32_t)(now - Tasks[i].next) < 0)
+            continue;
+
+        Tasks[i].task();
+
+        Tasks[i].next = Tasks[i].next + Tasks[i].period;
+        while((int32_t)(now - Tasks[i].next) >= 0)
+        {
+            Tasks[i].next = Tasks[i].next + Tasks[i].period;
+            TickLate = TickLate + 1;
+        }
+    }
+}
+
+
+// One WFI, with interrupts masked by the caller from its test up to here:
+// an interrupt that comes in between still ends the WFI, and runs at
+// CPUcpsie. The time asleep goes to the duty cycle.
+static void sleep(void)
+{
+    uint32_t before, after;
+
+    before = SysTickValueGet();
+    CPUwfi();
+    after = SysTickValueGet();
+
+    // SysTick counts down and wraps at most once, at the tick that wakes us
+    SleepCycles = SleepCycles + ((after <= before) ? (before - after) : (before + SysTickPeriodGet() - after));
+    while(SleepCycles >= ClockTicksPerMs)
+    {
+        SleepCycles = SleepCycles - ClockTicksPerMs;
+        Duty.sleptMs = Duty.sleptMs + 1;
+    }
+    Duty.wakes = Duty.wakes + 1;
+}
+
+
+// Return after the next tick and the tasks it made due. The CPU sleeps in
+// WFI until then, and again after any interrupt that was not the tick.
+void Tick_Wait(void)
+{
+    uint32_t now = TickMs;
+
+    while(TickMs == now)
+    {
+        CPUcpsid();
+        if(TickMs == now)
+            sleep();
+        CPUcpsie();
+    }
+
+    Tick_Run();
+}
+
+
+// Sleep with the tasks held for up to ms, or until an interrupt handler sets
+// *wake, such as the keypad's (Buttons_Sleep). Only the tick interrupt wakes
+// the CPU meanwhile, and it goes back to sleep at once. The tick keeps
+// counting so TickMs stays exact for the timestamps of the keys. The tasks
+// are all due when it returns and none counts late: Tick_Run them once the
+// caller has undone what it set up for the sleep.
+void Tick_Idle(volatile bool *wake, uint32_t ms)
+{
+    TickTimer timer;
+    uint8_t i;
+
+    Tick_TimerStart(&timer, ms);
+    while(!*wake && !Tick_TimerExpired(&timer))
+    {
+        CPUcpsid();
+        if(!*wake && !Tick_TimerExpired(&timer))
+            sleep();
+        CPUcpsie();
+    }
+
+    for(i = 0; i < TaskCount; i++)
+        Tasks[i].next = TickMs;
+}
+
+
+// Time asleep since the last Tick_DutyReset
+void Tick_Duty(TickDuty *duty)
+{
+    *duty = Duty;
+    duty->ms = TickMs - DutyStart;
+}
+
+
+void Tick_DutyReset(void)
+{
+    Duty.sleptMs = 0;
+    Duty.wakes = 0;
+    DutyStart = TickMs;
+    SleepCycles = 0;
+}
+
+
+// Let ms milliseconds pass, the tasks keep running
+void Tick_WaitMs(uint32_t ms)
+{
+    TickTimer timer;
+
+    Tick_TimerStart(&timer, ms);
+    while(!Tick_TimerExpired(&timer))
+        Tick_Wait();
+}
+
+
+void Tick_TimerStart(TickTimer *timer, uint32_t ms)
+{
+    *timer = TickMs + ms;
+}
+
+
+bool Tick_TimerExpired(const TickTimer *timer)
+{
+    return (int32_t)(TickMs - *timer) >= 0;
+}
+
+
+// The first step starts now
+void Tick_StepStart(TickStep *step, uint16_t periodMs)
+{
+    step->period = periodMs;
+    step->next = TickMs + periodMs;
+    step->steps = 0;
+    step->overruns = 0;
+}
+
+
+// End of a step: wait, running the tasks, for the next one to start
+void Tick_StepWait(TickStep *step)
+{
+    step->steps = step->steps + 1;
+
+    if((int32_t)(TickMs - step->next) > 0)
+    {
+        step->overruns = step->overruns + 1;
+        TickOverruns = TickOverruns + 1;
+        step->next = TickMs + step->period;
+        Tick_Run();
+        return;
+    }
+
+    while((int32_t)(TickMs - step->next) < 0)
+        Tick_Wait();
+
+    step->next = step->next + step->period;
+}
+
+
+void SysTick_Handler(void)
+{
+    TickMs = TickMs + 1;
+}
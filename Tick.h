@@ -0,0 +1,68 @@
+#ifndef TICK_H_
+#define TICK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 1 ms system tick on SysTick and a cooperative scheduler on top of it. The
+// interrupt only counts milliseconds. Periodic tasks (the keypad scan, the
+// animators, the display flush) run to completion from the main loop,
+// whenever it waits: Tick_Wait, Tick_WaitMs, Tick_StepWait or Tick_Run.
+// Waits sleep in WFI between interrupts. Tick_Idle also holds the tasks for
+// as long as the caller has nothing to do but wait for an interrupt.
+
+extern volatile uint32_t TickMs;            // Milliseconds since Tick_Init, wraps after 49 days
+extern uint32_t TickLate;                   // Task periods skipped because no wait came in time
+extern uint32_t TickOverruns;               // Steps of any TickStep that ended after their deadline
+
+// One slot per task main.c adds: the keypad scan, the animators and the
+// display flush
+#define TICK_TASKS  3
+
+// Longest Tick_Idle of Buttons_Sleep, so the loops that poll (the profiler
+// console) still come round
+#define TICK_IDLE_MS    100
+
+typedef void (*TickTask)(void);
+
+// Deadline of a millisecond timer, from Tick_TimerStart
+typedef uint32_t TickTimer;
+
+// Fixed timestep: a loop that calls Tick_StepWait at the end of each step
+// runs once every 'period' ms. A step that ends after its deadline is an
+// overrun; the next one starts at once and the cadence starts over from it.
+typedef struct
+{
+    uint32_t next;                          // TickMs the running step must end by
+    uint16_t period;
+    uint32_t steps;
+    uint32_t overruns;
+} TickStep;
+
+// Duty cycle: the CPU was awake (ms - sleptMs) of the ms since the reset
+typedef struct
+{
+    uint32_t ms;                            // Since Tick_DutyReset
+    uint32_t sleptMs;                       // In WFI
+    uint32_t wakes;                         // WFIs that ended
+} TickDuty;
+
+void Tick_Init          (void);
+bool Tick_Every         (TickTask task, uint16_t periodMs);
+void Tick_Run           (void);
+void Tick_Wait          (void);
+void Tick_WaitMs        (uint32_t ms);
+void Tick_Idle          (volatile bool *wake, uint32_t ms);
+
+void Tick_Duty          (TickDuty *duty);
+void Tick_DutyReset     (void);
+
+void Tick_TimerStart    (TickTimer *timer, uint32_t ms);
+bool Tick_TimerExpired  (const TickTimer *timer);
+
+void Tick_StepStart     (TickStep *step, uint16_t periodMs);
+void Tick_StepWait      (TickStep *step);
+
+void SysTick_Handler    (void);
+
+#endif
@@ -0,0 +1,60 @@
+#include "clips.h"
+#include "sprites.h"
+
+#define FRAMES(frames)  (frames), sizeof(frames) / sizeof((frames)[0])
+
+// Fighters breathe by one pixel, out of step with each other
+static const AnimFrame RyuIdle[] =
+{
+    {&Sprite_Ryu, &Sprite_Ryu_mask,  0,  0, 500},
+    {&Sprite_Ryu, &Sprite_Ryu_mask,  0, -1, 500},
+};
+
+// Lunge towards the opponent and step back
+static const AnimFrame RyuAttack[] =
+{
+    {&Sprite_Ryu, &Sprite_Ryu_mask,  2,  0,  60},
+    {&Sprite_Ryu, &Sprite_Ryu_mask,  5,  0,  60},
+    {&Sprite_Ryu, &Sprite_Ryu_mask,  8,  0, 250},
+    {&Sprite_Ryu, &Sprite_Ryu_mask,  4,  0,  80},
+};
+
+// Knocked back, blinking
+static const AnimFrame RyuHit[] =
+{
+    {&Sprite_Ryu, &Sprite_Ryu_mask, -2,  0, 100},
+    {0,           0,                 0,  0, 100},
+    {&Sprite_Ryu, &Sprite_Ryu_mask, -2,  0, 100},
+    {0,           0,                 0,  0, 100},
+    {&Sprite_Ryu, &Sprite_Ryu_mask, -1,  0, 150},
+};
+
+static const AnimFrame ZangiefIdle[] =
+{
+    {&Sprite_Zangief, &Sprite_Zangief_mask,  0, -1, 500},
+    {&Sprite_Zangief, &Sprite_Zangief_mask,  0,  0, 500},
+};
+
+static const AnimFrame ZangiefAttack[] =
+{
+    {&Sprite_Zangief, &Sprite_Zangief_mask, -2,  0,  60},
+    {&Sprite_Zangief, &Sprite_Zangief_mask, -5,  0,  60},
+    {&Sprite_Zangief, &Sprite_Zangief_mask, -8,  0, 250},
+    {&Sprite_Zangief, &Sprite_Zangief_mask, -4,  0,  80},
+};
+
+static const AnimFrame ZangiefHit[] =
+{
+    {&Sprite_Zangief, &Sprite_Zangief_mask,  2,  0, 100},
+    {0,               0,                     0,  0, 100},
+    {&Sprite_Zangief, &Sprite_Zangief_mask,  2,  0, 100},
+    {0,               0,                     0,  0, 100},
+    {&Sprite_Zangief, &Sprite_Zangief_mask,  1,  0, 150},
+};
+
+const AnimClip Clip_RyuIdle         = {FRAMES(RyuIdle),         &Clip_RyuIdle};
+const AnimClip Clip_RyuAttack       = {FRAMES(RyuAttack),       &Clip_RyuIdle};
+const AnimClip Clip_RyuHit          = {FRAMES(RyuHit),          &Clip_RyuIdle};
+const AnimClip Clip_ZangiefIdle     = {FRAMES(ZangiefIdle),     &Clip_ZangiefIdle};
+const AnimClip Clip_ZangiefAttack   = {FRAMES(ZangiefAttack),   &Clip_ZangiefIdle};
+const AnimClip Clip_ZangiefHit      = {FRAMES(ZangiefHit),      &Clip_ZangiefIdle};
@@ -0,0 +1,15 @@
+#ifndef CLIPS_H
+#define CLIPS_H
+
+#include "Anim.h"
+
+// Fighter clips, drawn from where Atualiza_Luta puts the fighters.
+// Attack and hit go back to idle when they are over.
+extern const AnimClip Clip_RyuIdle;
+extern const AnimClip Clip_RyuAttack;
+extern const AnimClip Clip_RyuHit;
+extern const AnimClip Clip_ZangiefIdle;
+extern const AnimClip Clip_ZangiefAttack;
+extern const AnimClip Clip_ZangiefHit;
+
+#endif
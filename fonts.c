@@ -0,0 +1,425 @@
+// Generated by tools/fontgen.py from Symbols.h -- do not edit.
+// Glyph tables for Font_PrintChar and Font_Print, one per font and orientation.
+
+#include "fonts.h"
+
+static const uint8_t Font_5x8_data[] = {    // 679 bytes
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x00, 0x24, 0x2A, 0x7F,
+    0x2A, 0x12, 0x00, 0x00, 0x23, 0x13, 0x08, 0x64, 0x62, 0x00, 0x00, 0x36, 0x49, 0x55, 0x22, 0x50,
+    0x00, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00,
+    0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00, 0x14, 0x08, 0x3E, 0x08, 0x14, 0x00, 0x00, 0x08, 0x08,
+    0x3E, 0x08, 0x08, 0x00, 0x00, 0x00, 0x50, 0x30, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00,
+    0x00, 0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00, 0x00, 0x00, 0x42, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x42,
+    0x61, 0x51, 0x49, 0x46, 0x00, 0x00, 0x21, 0x41, 0x45, 0x4B, 0x31, 0x00, 0x00, 0x18, 0x14, 0x12,
+    0x7F, 0x10, 0x00, 0x00, 0x27, 0x45, 0x45, 0x45, 0x39, 0x00, 0x00, 0x3C, 0x4A, 0x49, 0x49, 0x30,
+    0x00, 0x00, 0x01, 0x71, 0x09, 0x05, 0x03, 0x00, 0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x00,
+    0x06, 0x49, 0x49, 0x29, 0x1E, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+    0x36, 0x00, 0x00, 0x00, 0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x00, 0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00,
+    0x00, 0x32, 0x49, 0x79, 0x41, 0x3E, 0x00, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x00, 0x7F,
+    0x49, 0x49, 0x49, 0x36, 0x00, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x00, 0x7F, 0x41, 0x41,
+    0x22, 0x1C, 0x00, 0x00, 0x7F, 0x49, 0x49, 0x49, 0x41, 0x00, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01,
+    0x00, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00, 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x00, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x00, 0x00, 0x7F, 0x08,
+    0x14, 0x22, 0x41, 0x00, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x7F, 0x02, 0x0C, 0x02,
+    0x7F, 0x00, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x00, 0x7F, 0x09, 0x09, 0x09, 0x06, 0x00, 0x00, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x00, 0x00, 0x7F,
+    0x09, 0x19, 0x29, 0x46, 0x00, 0x00, 0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x00, 0x01, 0x01, 0x7F,
+    0x01, 0x01, 0x00, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00, 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F,
+    0x00, 0x00, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x00,
+    0x07, 0x08, 0x70, 0x08, 0x07, 0x00, 0x00, 0x61, 0x51, 0x49, 0x45, 0x43, 0x00, 0x00, 0x00, 0x7F,
+    0x41, 0x41, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00, 0x00, 0x41, 0x41, 0x7F,
+    0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x00, 0x01, 0x02, 0x04, 0x00, 0x00, 0x00, 0x20, 0x54, 0x54, 0x54, 0x78, 0x00, 0x00, 0x7F,
+    0x48, 0x44, 0x44, 0x38, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00, 0x00, 0x38, 0x44, 0x44,
+    0x48, 0x7F, 0x00, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x00, 0x08, 0x7E, 0x09, 0x01, 0x02,
+    0x00, 0x00, 0x0C, 0x52, 0x52, 0x52, 0x3E, 0x00, 0x00, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00,
+    0x00, 0x44, 0x7D, 0x40, 0x00, 0x00, 0x00, 0x20, 0x40, 0x44, 0x3D, 0x00, 0x00, 0x00, 0x7F, 0x10,
+    0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x41, 0x7F, 0x40, 0x00, 0x00, 0x00, 0x7C, 0x04, 0x18, 0x04,
+    0x78, 0x00, 0x00, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+    0x00, 0x7C, 0x14, 0x14, 0x14, 0x08, 0x00, 0x00, 0x08, 0x14, 0x14, 0x18, 0x7C, 0x00, 0x00, 0x7C,
+    0x08, 0x04, 0x04, 0x08, 0x00, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00, 0x04, 0x3F, 0x44,
+    0x40, 0x20, 0x00, 0x00, 0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C,
+    0x00, 0x00, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00,
+    0x0C, 0x50, 0x50, 0x50, 0x3C, 0x00, 0x00, 0x44, 0x64, 0x54, 0x4C, 0x44, 0x00, 0x00, 0x00, 0x08,
+    0x36, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x36, 0x08,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x10, 0x08, 0x00, 0x00, 0x1F, 0x24, 0x7C, 0x24, 0x1F, 0x00,
+    0x00, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00,
+};
+
+const Font Font_5x8 =
+{
+    0x20, 97, 8, 7, 7, FONT_RIGHT,
+    Font_5x8_data, 0, 0
+};
+
+static const uint8_t Font_5x8_Prop_data[] = {    // 527 bytes
+    0x00, 0x00, 0x00, 0x5F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x24,
+    0x2A, 0x7F, 0x2A, 0x12, 0x00, 0x23, 0x13, 0x08, 0x64, 0x62, 0x00, 0x36, 0x49, 0x55, 0x22, 0x50,
+    0x00, 0x05, 0x03, 0x00, 0x1C, 0x22, 0x41, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x14, 0x08, 0x3E, 0x08,
+    0x14, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x50, 0x30, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x60, 0x60, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00,
+    0x42, 0x7F, 0x40, 0x00, 0x42, 0x61, 0x51, 0x49, 0x46, 0x00, 0x21, 0x41, 0x45, 0x4B, 0x31, 0x00,
+    0x18, 0x14, 0x12, 0x7F, 0x10, 0x00, 0x27, 0x45, 0x45, 0x45, 0x39, 0x00, 0x3C, 0x4A, 0x49, 0x49,
+    0x30, 0x00, 0x01, 0x71, 0x09, 0x05, 0x03, 0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x06, 0x49,
+    0x49, 0x29, 0x1E, 0x00, 0x36, 0x36, 0x00, 0x56, 0x36, 0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x14,
+    0x14, 0x14, 0x14, 0x14, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x02, 0x01, 0x51, 0x09, 0x06, 0x00,
+    0x32, 0x49, 0x79, 0x41, 0x3E, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x7F, 0x49, 0x49, 0x49,
+    0x36, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x22, 0x00, 0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00, 0x7F, 0x49,
+    0x49, 0x49, 0x41, 0x00, 0x7F, 0x09, 0x09, 0x09, 0x01, 0x00, 0x3E, 0x41, 0x49, 0x49, 0x7A, 0x00,
+    0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x41, 0x7F, 0x41, 0x00, 0x20, 0x40, 0x41, 0x3F, 0x01, 0x00,
+    0x7F, 0x08, 0x14, 0x22, 0x41, 0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x00, 0x7F, 0x02, 0x0C, 0x02,
+    0x7F, 0x00, 0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x7F, 0x09,
+    0x09, 0x09, 0x06, 0x00, 0x3E, 0x41, 0x51, 0x21, 0x5E, 0x00, 0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,
+    0x46, 0x49, 0x49, 0x49, 0x31, 0x00, 0x01, 0x01, 0x7F, 0x01, 0x01, 0x00, 0x3F, 0x40, 0x40, 0x40,
+    0x3F, 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F, 0x00, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00, 0x63, 0x14,
+    0x08, 0x14, 0x63, 0x00, 0x07, 0x08, 0x70, 0x08, 0x07, 0x00, 0x61, 0x51, 0x49, 0x45, 0x43, 0x00,
+    0x7F, 0x41, 0x41, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x41, 0x41, 0x7F, 0x00, 0x04, 0x02,
+    0x01, 0x02, 0x04, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00, 0x01, 0x02, 0x04, 0x00, 0x20, 0x54,
+    0x54, 0x54, 0x78, 0x00, 0x7F, 0x48, 0x44, 0x44, 0x38, 0x00, 0x38, 0x44, 0x44, 0x44, 0x20, 0x00,
+    0x38, 0x44, 0x44, 0x48, 0x7F, 0x00, 0x38, 0x54, 0x54, 0x54, 0x18, 0x00, 0x08, 0x7E, 0x09, 0x01,
+    0x02, 0x00, 0x0C, 0x52, 0x52, 0x52, 0x3E, 0x00, 0x7F, 0x08, 0x04, 0x04, 0x78, 0x00, 0x44, 0x7D,
+    0x40, 0x00, 0x20, 0x40, 0x44, 0x3D, 0x00, 0x7F, 0x10, 0x28, 0x44, 0x00, 0x41, 0x7F, 0x40, 0x00,
+    0x7C, 0x04, 0x18, 0x04, 0x78, 0x00, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, 0x38, 0x44, 0x44, 0x44,
+    0x38, 0x00, 0x7C, 0x14, 0x14, 0x14, 0x08, 0x00, 0x08, 0x14, 0x14, 0x18, 0x7C, 0x00, 0x7C, 0x08,
+    0x04, 0x04, 0x08, 0x00, 0x48, 0x54, 0x54, 0x54, 0x20, 0x00, 0x04, 0x3F, 0x44, 0x40, 0x20, 0x00,
+    0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00, 0x3C, 0x40, 0x30, 0x40,
+    0x3C, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x0C, 0x50, 0x50, 0x50, 0x3C, 0x00, 0x44, 0x64,
+    0x54, 0x4C, 0x44, 0x00, 0x08, 0x36, 0x41, 0x00, 0x7F, 0x00, 0x41, 0x36, 0x08, 0x00, 0x10, 0x08,
+    0x08, 0x10, 0x08, 0x00, 0x1F, 0x24, 0x7C, 0x24, 0x1F, 0x00, 0x06, 0x09, 0x09, 0x06, 0x00,
+};
+
+static const uint16_t Font_5x8_Prop_offset[] = {
+    0, 3, 5, 9, 15, 21, 27, 33, 36, 40, 44, 50,
+    56, 59, 65, 68, 74, 80, 84, 90, 96, 102, 108, 114,
+    120, 126, 132, 135, 138, 143, 149, 154, 160, 166, 172, 178,
+    184, 190, 196, 202, 208, 214, 218, 224, 230, 236, 242, 248,
+    254, 260, 266, 272, 278, 284, 290, 296, 302, 308, 314, 320,
+    324, 330, 334, 340, 346, 350, 356, 362, 368, 374, 380, 386,
+    392, 398, 402, 407, 412, 416, 422, 428, 434, 440, 446, 452,
+    458, 464, 470, 476, 482, 488, 494, 500, 504, 506, 510, 516,
+    522,
+};
+
+static const uint8_t Font_5x8_Prop_advance[] = {
+    3, 2, 4, 6, 6, 6, 6, 3, 4, 4, 6, 6, 3, 6, 3, 6,
+    6, 4, 6, 6, 6, 6, 6, 6, 6, 6, 3, 3, 5, 6, 5, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 6, 4, 6, 6,
+    4, 6, 6, 6, 6, 6, 6, 6, 6, 4, 5, 5, 4, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 2, 4, 6, 6,
+    5,
+};
+
+const Font Font_5x8_Prop =
+{
+    0x20, 97, 8, 0, 0, FONT_RIGHT,
+    Font_5x8_Prop_data, Font_5x8_Prop_offset, Font_5x8_Prop_advance
+};
+
+static const uint8_t Font_5x8_Upside_data[] = {    // 679 bytes
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x28, 0xFE, 0x28, 0xFE, 0x28, 0x00, 0x00, 0x48, 0x54, 0xFE,
+    0x54, 0x24, 0x00, 0x00, 0x46, 0x26, 0x10, 0xC8, 0xC4, 0x00, 0x00, 0x0A, 0x44, 0xAA, 0x92, 0x6C,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x82, 0x44, 0x38, 0x00, 0x00, 0x00,
+    0x00, 0x38, 0x44, 0x82, 0x00, 0x00, 0x00, 0x28, 0x10, 0x7C, 0x10, 0x28, 0x00, 0x00, 0x10, 0x10,
+    0x7C, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0A, 0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00,
+    0x00, 0x7C, 0xA2, 0x92, 0x8A, 0x7C, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x42, 0x00, 0x00, 0x00, 0x62,
+    0x92, 0x8A, 0x86, 0x42, 0x00, 0x00, 0x8C, 0xD2, 0xA2, 0x82, 0x84, 0x00, 0x00, 0x08, 0xFE, 0x48,
+    0x28, 0x18, 0x00, 0x00, 0x9C, 0xA2, 0xA2, 0xA2, 0xE4, 0x00, 0x00, 0x0C, 0x92, 0x92, 0x52, 0x3C,
+    0x00, 0x00, 0xC0, 0xA0, 0x90, 0x8E, 0x80, 0x00, 0x00, 0x6C, 0x92, 0x92, 0x92, 0x6C, 0x00, 0x00,
+    0x78, 0x94, 0x92, 0x92, 0x60, 0x00, 0x00, 0x00, 0x00, 0x6C, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x6C, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x82, 0x44, 0x28, 0x10, 0x00, 0x00, 0x28, 0x28, 0x28, 0x28,
+    0x28, 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, 0x00, 0x60, 0x90, 0x8A, 0x80, 0x40, 0x00,
+    0x00, 0x7C, 0x82, 0x9E, 0x92, 0x4C, 0x00, 0x00, 0x7E, 0x88, 0x88, 0x88, 0x7E, 0x00, 0x00, 0x6C,
+    0x92, 0x92, 0x92, 0xFE, 0x00, 0x00, 0x44, 0x82, 0x82, 0x82, 0x7C, 0x00, 0x00, 0x38, 0x44, 0x82,
+    0x82, 0xFE, 0x00, 0x00, 0x82, 0x92, 0x92, 0x92, 0xFE, 0x00, 0x00, 0x80, 0x90, 0x90, 0x90, 0xFE,
+    0x00, 0x00, 0x5E, 0x92, 0x92, 0x82, 0x7C, 0x00, 0x00, 0xFE, 0x10, 0x10, 0x10, 0xFE, 0x00, 0x00,
+    0x00, 0x82, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x80, 0xFC, 0x82, 0x02, 0x04, 0x00, 0x00, 0x82, 0x44,
+    0x28, 0x10, 0xFE, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x00, 0x00, 0xFE, 0x40, 0x30, 0x40,
+    0xFE, 0x00, 0x00, 0xFE, 0x08, 0x10, 0x20, 0xFE, 0x00, 0x00, 0x7C, 0x82, 0x82, 0x82, 0x7C, 0x00,
+    0x00, 0x60, 0x90, 0x90, 0x90, 0xFE, 0x00, 0x00, 0x7A, 0x84, 0x8A, 0x82, 0x7C, 0x00, 0x00, 0x62,
+    0x94, 0x98, 0x90, 0xFE, 0x00, 0x00, 0x8C, 0x92, 0x92, 0x92, 0x62, 0x00, 0x00, 0x80, 0x80, 0xFE,
+    0x80, 0x80, 0x00, 0x00, 0xFC, 0x02, 0x02, 0x02, 0xFC, 0x00, 0x00, 0xF8, 0x04, 0x02, 0x04, 0xF8,
+    0x00, 0x00, 0xFC, 0x02, 0x1C, 0x02, 0xFC, 0x00, 0x00, 0xC6, 0x28, 0x10, 0x28, 0xC6, 0x00, 0x00,
+    0xE0, 0x10, 0x0E, 0x10, 0xE0, 0x00, 0x00, 0xC2, 0xA2, 0x92, 0x8A, 0x86, 0x00, 0x00, 0x00, 0x82,
+    0x82, 0xFE, 0x00, 0x00, 0x00, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0xFE, 0x82, 0x82,
+    0x00, 0x00, 0x00, 0x20, 0x40, 0x80, 0x40, 0x20, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x1E, 0x2A, 0x2A, 0x2A, 0x04, 0x00, 0x00, 0x1C,
+    0x22, 0x22, 0x12, 0xFE, 0x00, 0x00, 0x04, 0x22, 0x22, 0x22, 0x1C, 0x00, 0x00, 0xFE, 0x12, 0x22,
+    0x22, 0x1C, 0x00, 0x00, 0x18, 0x2A, 0x2A, 0x2A, 0x1C, 0x00, 0x00, 0x40, 0x80, 0x90, 0x7E, 0x10,
+    0x00, 0x00, 0x7C, 0x4A, 0x4A, 0x4A, 0x30, 0x00, 0x00, 0x1E, 0x20, 0x20, 0x10, 0xFE, 0x00, 0x00,
+    0x00, 0x02, 0xBE, 0x22, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x22, 0x02, 0x04, 0x00, 0x00, 0x00, 0x22,
+    0x14, 0x08, 0xFE, 0x00, 0x00, 0x00, 0x02, 0xFE, 0x82, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x18, 0x20,
+    0x3E, 0x00, 0x00, 0x1E, 0x20, 0x20, 0x10, 0x3E, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x1C, 0x00,
+    0x00, 0x10, 0x28, 0x28, 0x28, 0x3E, 0x00, 0x00, 0x3E, 0x18, 0x28, 0x28, 0x10, 0x00, 0x00, 0x10,
+    0x20, 0x20, 0x10, 0x3E, 0x00, 0x00, 0x04, 0x2A, 0x2A, 0x2A, 0x12, 0x00, 0x00, 0x04, 0x02, 0x22,
+    0xFC, 0x20, 0x00, 0x00, 0x3E, 0x04, 0x02, 0x02, 0x3C, 0x00, 0x00, 0x38, 0x04, 0x02, 0x04, 0x38,
+    0x00, 0x00, 0x3C, 0x02, 0x0C, 0x02, 0x3C, 0x00, 0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00,
+    0x3C, 0x0A, 0x0A, 0x0A, 0x30, 0x00, 0x00, 0x22, 0x32, 0x2A, 0x26, 0x22, 0x00, 0x00, 0x00, 0x82,
+    0x6C, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x6C, 0x82,
+    0x00, 0x00, 0x00, 0x10, 0x08, 0x10, 0x10, 0x08, 0x00, 0x00, 0xF8, 0x24, 0x3E, 0x24, 0xF8, 0x00,
+    0x00, 0x60, 0x90, 0x90, 0x60, 0x00, 0x00,
+};
+
+const Font Font_5x8_Upside =
+{
+    0x20, 97, 8, 7, 7, FONT_LEFT,
+    Font_5x8_Upside_data, 0, 0
+};
+
+static const uint8_t Font_5x8_Mirror_data[] = {    // 679 bytes
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00, 0x00, 0x12, 0x2A, 0x7F,
+    0x2A, 0x24, 0x00, 0x00, 0x62, 0x64, 0x08, 0x13, 0x23, 0x00, 0x00, 0x50, 0x22, 0x55, 0x49, 0x36,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x1C, 0x22, 0x41, 0x00, 0x00, 0x00, 0x14, 0x08, 0x3E, 0x08, 0x14, 0x00, 0x00, 0x08, 0x08,
+    0x3E, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x30, 0x50, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00,
+    0x00, 0x3E, 0x45, 0x49, 0x51, 0x3E, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x42, 0x00, 0x00, 0x00, 0x46,
+    0x49, 0x51, 0x61, 0x42, 0x00, 0x00, 0x31, 0x4B, 0x45, 0x41, 0x21, 0x00, 0x00, 0x10, 0x7F, 0x12,
+    0x14, 0x18, 0x00, 0x00, 0x39, 0x45, 0x45, 0x45, 0x27, 0x00, 0x00, 0x30, 0x49, 0x49, 0x4A, 0x3C,
+    0x00, 0x00, 0x03, 0x05, 0x09, 0x71, 0x01, 0x00, 0x00, 0x36, 0x49, 0x49, 0x49, 0x36, 0x00, 0x00,
+    0x1E, 0x29, 0x49, 0x49, 0x06, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x36, 0x56, 0x00, 0x00, 0x00, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x14, 0x14, 0x14, 0x14,
+    0x14, 0x00, 0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x00, 0x00, 0x06, 0x09, 0x51, 0x01, 0x02, 0x00,
+    0x00, 0x3E, 0x41, 0x79, 0x49, 0x32, 0x00, 0x00, 0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00, 0x00, 0x36,
+    0x49, 0x49, 0x49, 0x7F, 0x00, 0x00, 0x22, 0x41, 0x41, 0x41, 0x3E, 0x00, 0x00, 0x1C, 0x22, 0x41,
+    0x41, 0x7F, 0x00, 0x00, 0x41, 0x49, 0x49, 0x49, 0x7F, 0x00, 0x00, 0x01, 0x09, 0x09, 0x09, 0x7F,
+    0x00, 0x00, 0x7A, 0x49, 0x49, 0x41, 0x3E, 0x00, 0x00, 0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00, 0x00,
+    0x00, 0x41, 0x7F, 0x41, 0x00, 0x00, 0x00, 0x01, 0x3F, 0x41, 0x40, 0x20, 0x00, 0x00, 0x41, 0x22,
+    0x14, 0x08, 0x7F, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x00, 0x00, 0x7F, 0x02, 0x0C, 0x02,
+    0x7F, 0x00, 0x00, 0x7F, 0x10, 0x08, 0x04, 0x7F, 0x00, 0x00, 0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,
+    0x00, 0x06, 0x09, 0x09, 0x09, 0x7F, 0x00, 0x00, 0x5E, 0x21, 0x51, 0x41, 0x3E, 0x00, 0x00, 0x46,
+    0x29, 0x19, 0x09, 0x7F, 0x00, 0x00, 0x31, 0x49, 0x49, 0x49, 0x46, 0x00, 0x00, 0x01, 0x01, 0x7F,
+    0x01, 0x01, 0x00, 0x00, 0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00, 0x00, 0x1F, 0x20, 0x40, 0x20, 0x1F,
+    0x00, 0x00, 0x3F, 0x40, 0x38, 0x40, 0x3F, 0x00, 0x00, 0x63, 0x14, 0x08, 0x14, 0x63, 0x00, 0x00,
+    0x07, 0x08, 0x70, 0x08, 0x07, 0x00, 0x00, 0x43, 0x45, 0x49, 0x51, 0x61, 0x00, 0x00, 0x00, 0x41,
+    0x41, 0x7F, 0x00, 0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x7F, 0x41, 0x41,
+    0x00, 0x00, 0x00, 0x04, 0x02, 0x01, 0x02, 0x04, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x00,
+    0x00, 0x00, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x78, 0x54, 0x54, 0x54, 0x20, 0x00, 0x00, 0x38,
+    0x44, 0x44, 0x48, 0x7F, 0x00, 0x00, 0x20, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x7F, 0x48, 0x44,
+    0x44, 0x38, 0x00, 0x00, 0x18, 0x54, 0x54, 0x54, 0x38, 0x00, 0x00, 0x02, 0x01, 0x09, 0x7E, 0x08,
+    0x00, 0x00, 0x3E, 0x52, 0x52, 0x52, 0x0C, 0x00, 0x00, 0x78, 0x04, 0x04, 0x08, 0x7F, 0x00, 0x00,
+    0x00, 0x40, 0x7D, 0x44, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x44, 0x40, 0x20, 0x00, 0x00, 0x00, 0x44,
+    0x28, 0x10, 0x7F, 0x00, 0x00, 0x00, 0x40, 0x7F, 0x41, 0x00, 0x00, 0x00, 0x78, 0x04, 0x18, 0x04,
+    0x7C, 0x00, 0x00, 0x78, 0x04, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00,
+    0x00, 0x08, 0x14, 0x14, 0x14, 0x7C, 0x00, 0x00, 0x7C, 0x18, 0x14, 0x14, 0x08, 0x00, 0x00, 0x08,
+    0x04, 0x04, 0x08, 0x7C, 0x00, 0x00, 0x20, 0x54, 0x54, 0x54, 0x48, 0x00, 0x00, 0x20, 0x40, 0x44,
+    0x3F, 0x04, 0x00, 0x00, 0x7C, 0x20, 0x40, 0x40, 0x3C, 0x00, 0x00, 0x1C, 0x20, 0x40, 0x20, 0x1C,
+    0x00, 0x00, 0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00,
+    0x3C, 0x50, 0x50, 0x50, 0x0C, 0x00, 0x00, 0x44, 0x4C, 0x54, 0x64, 0x44, 0x00, 0x00, 0x00, 0x41,
+    0x36, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x36, 0x41,
+    0x00, 0x00, 0x00, 0x08, 0x10, 0x08, 0x08, 0x10, 0x00, 0x00, 0x1F, 0x24, 0x7C, 0x24, 0x1F, 0x00,
+    0x00, 0x06, 0x09, 0x09, 0x06, 0x00, 0x00,
+};
+
+const Font Font_5x8_Mirror =
+{
+    0x20, 97, 8, 7, 7, FONT_LEFT,
+    Font_5x8_Mirror_data, 0, 0
+};
+
+static const uint8_t Font_5x8_Down_data[] = {    // 776 bytes
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x14, 0x00, 0x14, 0x14, 0x3E, 0x14, 0x3E, 0x14, 0x14,
+    0x00, 0x08, 0x1E, 0x28, 0x1C, 0x0A, 0x3C, 0x08, 0x00, 0x30, 0x32, 0x04, 0x08, 0x10, 0x26, 0x06,
+    0x00, 0x2C, 0x12, 0x2A, 0x04, 0x0A, 0x12, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x0C,
+    0x00, 0x10, 0x08, 0x04, 0x04, 0x04, 0x08, 0x10, 0x00, 0x04, 0x08, 0x10, 0x10, 0x10, 0x08, 0x04,
+    0x00, 0x00, 0x08, 0x2A, 0x1C, 0x2A, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00,
+    0x00, 0x04, 0x08, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,
+    0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00,
+    0x00, 0x1C, 0x22, 0x26, 0x2A, 0x32, 0x22, 0x1C, 0x00, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x08,
+    0x00, 0x3E, 0x04, 0x08, 0x10, 0x20, 0x22, 0x1C, 0x00, 0x1C, 0x22, 0x20, 0x10, 0x08, 0x10, 0x3E,
+    0x00, 0x10, 0x10, 0x3E, 0x12, 0x14, 0x18, 0x10, 0x00, 0x1C, 0x22, 0x20, 0x20, 0x1E, 0x02, 0x3E,
+    0x00, 0x1C, 0x22, 0x22, 0x1E, 0x02, 0x04, 0x18, 0x00, 0x04, 0x04, 0x04, 0x08, 0x10, 0x20, 0x3E,
+    0x00, 0x1C, 0x22, 0x22, 0x1C, 0x22, 0x22, 0x1C, 0x00, 0x0C, 0x10, 0x20, 0x3C, 0x22, 0x22, 0x1C,
+    0x00, 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x04, 0x08, 0x0C, 0x00, 0x0C, 0x0C, 0x00,
+    0x00, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00,
+    0x00, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x00, 0x08, 0x00, 0x08, 0x10, 0x20, 0x22, 0x1C,
+    0x00, 0x1C, 0x2A, 0x2A, 0x2C, 0x20, 0x22, 0x1C, 0x00, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x22, 0x1C,
+    0x00, 0x1E, 0x22, 0x22, 0x1E, 0x22, 0x22, 0x1E, 0x00, 0x1C, 0x22, 0x02, 0x02, 0x02, 0x22, 0x1C,
+    0x00, 0x0E, 0x12, 0x22, 0x22, 0x22, 0x12, 0x0E, 0x00, 0x3E, 0x02, 0x02, 0x1E, 0x02, 0x02, 0x3E,
+    0x00, 0x02, 0x02, 0x02, 0x1E, 0x02, 0x02, 0x3E, 0x00, 0x3C, 0x22, 0x22, 0x3A, 0x02, 0x22, 0x1C,
+    0x00, 0x22, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x22, 0x00, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C,
+    0x00, 0x0C, 0x12, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x22, 0x12, 0x0A, 0x06, 0x0A, 0x12, 0x22,
+    0x00, 0x3E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x36, 0x22,
+    0x00, 0x22, 0x22, 0x32, 0x2A, 0x26, 0x22, 0x22, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1C,
+    0x00, 0x02, 0x02, 0x02, 0x1E, 0x22, 0x22, 0x1E, 0x00, 0x2C, 0x12, 0x2A, 0x22, 0x22, 0x22, 0x1C,
+    0x00, 0x22, 0x12, 0x0A, 0x1E, 0x22, 0x22, 0x1E, 0x00, 0x1E, 0x20, 0x20, 0x1C, 0x02, 0x02, 0x3C,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3E, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x08, 0x14, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x14, 0x2A, 0x2A, 0x2A, 0x22, 0x22, 0x22,
+    0x00, 0x22, 0x22, 0x14, 0x08, 0x14, 0x22, 0x22, 0x00, 0x08, 0x08, 0x08, 0x14, 0x22, 0x22, 0x22,
+    0x00, 0x3E, 0x02, 0x04, 0x08, 0x10, 0x20, 0x3E, 0x00, 0x1C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1C,
+    0x00, 0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x1C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x14, 0x08, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x00, 0x3C, 0x22, 0x3C, 0x20, 0x1C, 0x00, 0x00,
+    0x00, 0x1E, 0x22, 0x22, 0x26, 0x1A, 0x02, 0x02, 0x00, 0x1C, 0x22, 0x02, 0x02, 0x1C, 0x00, 0x00,
+    0x00, 0x3C, 0x22, 0x22, 0x32, 0x2C, 0x20, 0x20, 0x00, 0x1C, 0x02, 0x3E, 0x22, 0x1C, 0x00, 0x00,
+    0x00, 0x04, 0x04, 0x04, 0x0E, 0x04, 0x24, 0x18, 0x00, 0x1C, 0x20, 0x3C, 0x22, 0x22, 0x3C, 0x00,
+    0x00, 0x22, 0x22, 0x22, 0x26, 0x1A, 0x02, 0x02, 0x00, 0x1C, 0x08, 0x08, 0x08, 0x0C, 0x00, 0x08,
+    0x00, 0x0C, 0x12, 0x10, 0x10, 0x18, 0x00, 0x10, 0x00, 0x12, 0x0A, 0x06, 0x0A, 0x12, 0x02, 0x02,
+    0x00, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x00, 0x22, 0x22, 0x2A, 0x2A, 0x16, 0x00, 0x00,
+    0x00, 0x22, 0x22, 0x22, 0x26, 0x1A, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x1C, 0x00, 0x00,
+    0x00, 0x02, 0x02, 0x1E, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x20, 0x20, 0x3C, 0x32, 0x2C, 0x00, 0x00,
+    0x00, 0x02, 0x02, 0x02, 0x26, 0x1A, 0x00, 0x00, 0x00, 0x1E, 0x20, 0x1C, 0x02, 0x1C, 0x00, 0x00,
+    0x00, 0x18, 0x24, 0x04, 0x04, 0x0E, 0x04, 0x04, 0x00, 0x2C, 0x32, 0x22, 0x22, 0x22, 0x00, 0x00,
+    0x00, 0x08, 0x14, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x14, 0x2A, 0x2A, 0x22, 0x22, 0x00, 0x00,
+    0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x3C, 0x22, 0x22, 0x00, 0x00,
+    0x00, 0x3E, 0x04, 0x08, 0x10, 0x3E, 0x00, 0x00, 0x00, 0x10, 0x08, 0x08, 0x04, 0x08, 0x08, 0x10,
+    0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x04, 0x08, 0x08, 0x10, 0x08, 0x08, 0x04,
+    0x00, 0x00, 0x00, 0x12, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1C, 0x2A, 0x2A, 0x3E, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x24, 0x24, 0x18,
+};
+
+const Font Font_5x8_Down =
+{
+    0x20, 97, 8, 7, 8, FONT_DOWN,
+    Font_5x8_Down_data, 0, 0
+};
+
+static const uint8_t Font_5x8_Up_data[] = {    // 776 bytes
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x08, 0x00,
+    0x14, 0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x14, 0x3E, 0x14, 0x3E, 0x14, 0x14, 0x00,
+    0x08, 0x1E, 0x28, 0x1C, 0x0A, 0x3C, 0x08, 0x00, 0x30, 0x32, 0x04, 0x08, 0x10, 0x26, 0x06, 0x00,
+    0x18, 0x24, 0x28, 0x10, 0x2A, 0x24, 0x1A, 0x00, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x04, 0x08, 0x10, 0x10, 0x10, 0x08, 0x04, 0x00, 0x10, 0x08, 0x04, 0x04, 0x04, 0x08, 0x10, 0x00,
+    0x00, 0x08, 0x2A, 0x1C, 0x2A, 0x08, 0x00, 0x00, 0x00, 0x08, 0x08, 0x3E, 0x08, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x00, 0x00,
+    0x1C, 0x22, 0x26, 0x2A, 0x32, 0x22, 0x1C, 0x00, 0x08, 0x18, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00,
+    0x1C, 0x22, 0x02, 0x04, 0x08, 0x10, 0x3E, 0x00, 0x3E, 0x04, 0x08, 0x04, 0x02, 0x22, 0x1C, 0x00,
+    0x04, 0x0C, 0x14, 0x24, 0x3E, 0x04, 0x04, 0x00, 0x3E, 0x20, 0x3C, 0x02, 0x02, 0x22, 0x1C, 0x00,
+    0x0C, 0x10, 0x20, 0x3C, 0x22, 0x22, 0x1C, 0x00, 0x3E, 0x02, 0x04, 0x08, 0x10, 0x10, 0x10, 0x00,
+    0x1C, 0x22, 0x22, 0x1C, 0x22, 0x22, 0x1C, 0x00, 0x1C, 0x22, 0x22, 0x1E, 0x02, 0x04, 0x18, 0x00,
+    0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x18, 0x08, 0x10, 0x00,
+    0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x00, 0x00,
+    0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x00, 0x1C, 0x22, 0x02, 0x04, 0x08, 0x00, 0x08, 0x00,
+    0x1C, 0x22, 0x02, 0x1A, 0x2A, 0x2A, 0x1C, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x00,
+    0x3C, 0x22, 0x22, 0x3C, 0x22, 0x22, 0x3C, 0x00, 0x1C, 0x22, 0x20, 0x20, 0x20, 0x22, 0x1C, 0x00,
+    0x38, 0x24, 0x22, 0x22, 0x22, 0x24, 0x38, 0x00, 0x3E, 0x20, 0x20, 0x3C, 0x20, 0x20, 0x3E, 0x00,
+    0x3E, 0x20, 0x20, 0x3C, 0x20, 0x20, 0x20, 0x00, 0x1C, 0x22, 0x20, 0x2E, 0x22, 0x22, 0x1E, 0x00,
+    0x22, 0x22, 0x22, 0x3E, 0x22, 0x22, 0x22, 0x00, 0x1C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00,
+    0x0E, 0x04, 0x04, 0x04, 0x04, 0x24, 0x18, 0x00, 0x22, 0x24, 0x28, 0x30, 0x28, 0x24, 0x22, 0x00,
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3E, 0x00, 0x22, 0x36, 0x2A, 0x2A, 0x22, 0x22, 0x22, 0x00,
+    0x22, 0x22, 0x32, 0x2A, 0x26, 0x22, 0x22, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1C, 0x00,
+    0x3C, 0x22, 0x22, 0x3C, 0x20, 0x20, 0x20, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x2A, 0x24, 0x1A, 0x00,
+    0x3C, 0x22, 0x22, 0x3C, 0x28, 0x24, 0x22, 0x00, 0x1E, 0x20, 0x20, 0x1C, 0x02, 0x02, 0x3C, 0x00,
+    0x3E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x1C, 0x00,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x14, 0x08, 0x00, 0x22, 0x22, 0x22, 0x2A, 0x2A, 0x2A, 0x14, 0x00,
+    0x22, 0x22, 0x14, 0x08, 0x14, 0x22, 0x22, 0x00, 0x22, 0x22, 0x22, 0x14, 0x08, 0x08, 0x08, 0x00,
+    0x3E, 0x02, 0x04, 0x08, 0x10, 0x20, 0x3E, 0x00, 0x1C, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1C, 0x00,
+    0x00, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x1C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1C, 0x00,
+    0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00,
+    0x10, 0x08, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x02, 0x1E, 0x22, 0x1E, 0x00,
+    0x20, 0x20, 0x2C, 0x32, 0x22, 0x22, 0x3C, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x20, 0x22, 0x1C, 0x00,
+    0x02, 0x02, 0x1A, 0x26, 0x22, 0x22, 0x1E, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x3E, 0x20, 0x1C, 0x00,
+    0x0C, 0x12, 0x10, 0x38, 0x10, 0x10, 0x10, 0x00, 0x00, 0x1E, 0x22, 0x22, 0x1E, 0x02, 0x1C, 0x00,
+    0x20, 0x20, 0x2C, 0x32, 0x22, 0x22, 0x22, 0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x1C, 0x00,
+    0x04, 0x00, 0x0C, 0x04, 0x04, 0x24, 0x18, 0x00, 0x20, 0x20, 0x24, 0x28, 0x30, 0x28, 0x24, 0x00,
+    0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x1C, 0x00, 0x00, 0x00, 0x34, 0x2A, 0x2A, 0x22, 0x22, 0x00,
+    0x00, 0x00, 0x2C, 0x32, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x1C, 0x22, 0x22, 0x22, 0x1C, 0x00,
+    0x00, 0x00, 0x3C, 0x22, 0x3C, 0x20, 0x20, 0x00, 0x00, 0x00, 0x1A, 0x26, 0x1E, 0x02, 0x02, 0x00,
+    0x00, 0x00, 0x2C, 0x32, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x1C, 0x20, 0x1C, 0x02, 0x3C, 0x00,
+    0x10, 0x10, 0x38, 0x10, 0x10, 0x12, 0x0C, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x26, 0x1A, 0x00,
+    0x00, 0x00, 0x22, 0x22, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00, 0x22, 0x22, 0x2A, 0x2A, 0x14, 0x00,
+    0x00, 0x00, 0x22, 0x14, 0x08, 0x14, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x1E, 0x02, 0x1C, 0x00,
+    0x00, 0x00, 0x3E, 0x04, 0x08, 0x10, 0x3E, 0x00, 0x04, 0x08, 0x08, 0x10, 0x08, 0x08, 0x04, 0x00,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x10, 0x08, 0x08, 0x04, 0x08, 0x08, 0x10, 0x00,
+    0x00, 0x00, 0x00, 0x1A, 0x24, 0x00, 0x00, 0x00, 0x22, 0x22, 0x3E, 0x2A, 0x2A, 0x1C, 0x08, 0x00,
+    0x0C, 0x12, 0x12, 0x0C, 0x00, 0x00, 0x00, 0x00,
+};
+
+const Font Font_5x8_Up =
+{
+    0x20, 97, 8, 7, 8, FONT_UP,
+    Font_5x8_Up_data, 0, 0
+};
+
+static const uint8_t Font_3x5_data[] = {    // 380 bytes
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0x0A, 0x1F, 0x00,
+    0x12, 0x1F, 0x09, 0x00, 0x19, 0x04, 0x13, 0x00, 0x0A, 0x15, 0x1A, 0x00, 0x00, 0x03, 0x00, 0x00,
+    0x00, 0x0E, 0x11, 0x00, 0x11, 0x0E, 0x00, 0x00, 0x0A, 0x04, 0x0A, 0x00, 0x04, 0x0E, 0x04, 0x00,
+    0x10, 0x08, 0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x10, 0x00, 0x00, 0x18, 0x04, 0x03, 0x00,
+    0x1F, 0x11, 0x1F, 0x00, 0x12, 0x1F, 0x10, 0x00, 0x19, 0x15, 0x12, 0x00, 0x11, 0x15, 0x0A, 0x00,
+    0x07, 0x04, 0x1F, 0x00, 0x17, 0x15, 0x09, 0x00, 0x1E, 0x15, 0x1D, 0x00, 0x01, 0x1D, 0x03, 0x00,
+    0x1F, 0x15, 0x1F, 0x00, 0x17, 0x15, 0x0F, 0x00, 0x00, 0x0A, 0x00, 0x00, 0x10, 0x0A, 0x00, 0x00,
+    0x04, 0x0A, 0x11, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x11, 0x0A, 0x04, 0x00, 0x01, 0x15, 0x02, 0x00,
+    0x0E, 0x11, 0x16, 0x00, 0x1E, 0x05, 0x1E, 0x00, 0x1F, 0x15, 0x0A, 0x00, 0x0E, 0x11, 0x11, 0x00,
+    0x1F, 0x11, 0x0E, 0x00, 0x1F, 0x15, 0x15, 0x00, 0x1F, 0x05, 0x05, 0x00, 0x0E, 0x11, 0x1D, 0x00,
+    0x1F, 0x04, 0x1F, 0x00, 0x11, 0x1F, 0x11, 0x00, 0x08, 0x10, 0x0F, 0x00, 0x1F, 0x04, 0x1B, 0x00,
+    0x1F, 0x10, 0x10, 0x00, 0x1F, 0x06, 0x1F, 0x00, 0x1F, 0x01, 0x1E, 0x00, 0x0E, 0x11, 0x0E, 0x00,
+    0x1F, 0x05, 0x02, 0x00, 0x0E, 0x19, 0x16, 0x00, 0x1F, 0x05, 0x1A, 0x00, 0x12, 0x15, 0x09, 0x00,
+    0x01, 0x1F, 0x01, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x1F, 0x0C, 0x1F, 0x00,
+    0x1B, 0x04, 0x1B, 0x00, 0x03, 0x1C, 0x03, 0x00, 0x19, 0x15, 0x13, 0x00, 0x1F, 0x11, 0x00, 0x00,
+    0x03, 0x04, 0x18, 0x00, 0x00, 0x11, 0x1F, 0x00, 0x02, 0x01, 0x02, 0x00, 0x10, 0x10, 0x10, 0x00,
+    0x01, 0x02, 0x00, 0x00, 0x1E, 0x05, 0x1E, 0x00, 0x1F, 0x15, 0x0A, 0x00, 0x0E, 0x11, 0x11, 0x00,
+    0x1F, 0x11, 0x0E, 0x00, 0x1F, 0x15, 0x15, 0x00, 0x1F, 0x05, 0x05, 0x00, 0x0E, 0x11, 0x1D, 0x00,
+    0x1F, 0x04, 0x1F, 0x00, 0x11, 0x1F, 0x11, 0x00, 0x08, 0x10, 0x0F, 0x00, 0x1F, 0x04, 0x1B, 0x00,
+    0x1F, 0x10, 0x10, 0x00, 0x1F, 0x06, 0x1F, 0x00, 0x1F, 0x01, 0x1E, 0x00, 0x0E, 0x11, 0x0E, 0x00,
+    0x1F, 0x05, 0x02, 0x00, 0x0E, 0x19, 0x16, 0x00, 0x1F, 0x05, 0x1A, 0x00, 0x12, 0x15, 0x09, 0x00,
+    0x01, 0x1F, 0x01, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x1F, 0x0C, 0x1F, 0x00,
+    0x1B, 0x04, 0x1B, 0x00, 0x03, 0x1C, 0x03, 0x00, 0x19, 0x15, 0x13, 0x00, 0x04, 0x1F, 0x11, 0x00,
+    0x00, 0x1F, 0x00, 0x00, 0x11, 0x1F, 0x04, 0x00, 0x04, 0x06, 0x02, 0x00,
+};
+
+const Font Font_3x5 =
+{
+    0x20, 95, 6, 4, 4, FONT_RIGHT,
+    Font_3x5_data, 0, 0
+};
+
+static const uint8_t Font_3x5_Prop_data[] = {    // 361 bytes
+    0x00, 0x00, 0x17, 0x00, 0x03, 0x00, 0x03, 0x00, 0x1F, 0x0A, 0x1F, 0x00, 0x12, 0x1F, 0x09, 0x00,
+    0x19, 0x04, 0x13, 0x00, 0x0A, 0x15, 0x1A, 0x00, 0x03, 0x00, 0x0E, 0x11, 0x00, 0x11, 0x0E, 0x00,
+    0x0A, 0x04, 0x0A, 0x00, 0x04, 0x0E, 0x04, 0x00, 0x10, 0x08, 0x00, 0x04, 0x04, 0x04, 0x00, 0x10,
+    0x00, 0x18, 0x04, 0x03, 0x00, 0x1F, 0x11, 0x1F, 0x00, 0x12, 0x1F, 0x10, 0x00, 0x19, 0x15, 0x12,
+    0x00, 0x11, 0x15, 0x0A, 0x00, 0x07, 0x04, 0x1F, 0x00, 0x17, 0x15, 0x09, 0x00, 0x1E, 0x15, 0x1D,
+    0x00, 0x01, 0x1D, 0x03, 0x00, 0x1F, 0x15, 0x1F, 0x00, 0x17, 0x15, 0x0F, 0x00, 0x0A, 0x00, 0x10,
+    0x0A, 0x00, 0x04, 0x0A, 0x11, 0x00, 0x0A, 0x0A, 0x0A, 0x00, 0x11, 0x0A, 0x04, 0x00, 0x01, 0x15,
+    0x02, 0x00, 0x0E, 0x11, 0x16, 0x00, 0x1E, 0x05, 0x1E, 0x00, 0x1F, 0x15, 0x0A, 0x00, 0x0E, 0x11,
+    0x11, 0x00, 0x1F, 0x11, 0x0E, 0x00, 0x1F, 0x15, 0x15, 0x00, 0x1F, 0x05, 0x05, 0x00, 0x0E, 0x11,
+    0x1D, 0x00, 0x1F, 0x04, 0x1F, 0x00, 0x11, 0x1F, 0x11, 0x00, 0x08, 0x10, 0x0F, 0x00, 0x1F, 0x04,
+    0x1B, 0x00, 0x1F, 0x10, 0x10, 0x00, 0x1F, 0x06, 0x1F, 0x00, 0x1F, 0x01, 0x1E, 0x00, 0x0E, 0x11,
+    0x0E, 0x00, 0x1F, 0x05, 0x02, 0x00, 0x0E, 0x19, 0x16, 0x00, 0x1F, 0x05, 0x1A, 0x00, 0x12, 0x15,
+    0x09, 0x00, 0x01, 0x1F, 0x01, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x1F, 0x0C,
+    0x1F, 0x00, 0x1B, 0x04, 0x1B, 0x00, 0x03, 0x1C, 0x03, 0x00, 0x19, 0x15, 0x13, 0x00, 0x1F, 0x11,
+    0x00, 0x03, 0x04, 0x18, 0x00, 0x11, 0x1F, 0x00, 0x02, 0x01, 0x02, 0x00, 0x10, 0x10, 0x10, 0x00,
+    0x01, 0x02, 0x00, 0x1E, 0x05, 0x1E, 0x00, 0x1F, 0x15, 0x0A, 0x00, 0x0E, 0x11, 0x11, 0x00, 0x1F,
+    0x11, 0x0E, 0x00, 0x1F, 0x15, 0x15, 0x00, 0x1F, 0x05, 0x05, 0x00, 0x0E, 0x11, 0x1D, 0x00, 0x1F,
+    0x04, 0x1F, 0x00, 0x11, 0x1F, 0x11, 0x00, 0x08, 0x10, 0x0F, 0x00, 0x1F, 0x04, 0x1B, 0x00, 0x1F,
+    0x10, 0x10, 0x00, 0x1F, 0x06, 0x1F, 0x00, 0x1F, 0x01, 0x1E, 0x00, 0x0E, 0x11, 0x0E, 0x00, 0x1F,
+    0x05, 0x02, 0x00, 0x0E, 0x19, 0x16, 0x00, 0x1F, 0x05, 0x1A, 0x00, 0x12, 0x15, 0x09, 0x00, 0x01,
+    0x1F, 0x01, 0x00, 0x1F, 0x10, 0x1F, 0x00, 0x0F, 0x10, 0x0F, 0x00, 0x1F, 0x0C, 0x1F, 0x00, 0x1B,
+    0x04, 0x1B, 0x00, 0x03, 0x1C, 0x03, 0x00, 0x19, 0x15, 0x13, 0x00, 0x04, 0x1F, 0x11, 0x00, 0x1F,
+    0x00, 0x11, 0x1F, 0x04, 0x00, 0x04, 0x06, 0x02, 0x00,
+};
+
+static const uint16_t Font_3x5_Prop_offset[] = {
+    0, 2, 4, 8, 12, 16, 20, 24, 26, 29, 32, 36,
+    40, 43, 47, 49, 53, 57, 61, 65, 69, 73, 77, 81,
+    85, 89, 93, 95, 98, 102, 106, 110, 114, 118, 122, 126,
+    130, 134, 138, 142, 146, 150, 154, 158, 162, 166, 170, 174,
+    178, 182, 186, 190, 194, 198, 202, 206, 210, 214, 218, 222,
+    225, 229, 232, 236, 240, 243, 247, 251, 255, 259, 263, 267,
+    271, 275, 279, 283, 287, 291, 295, 299, 303, 307, 311, 315,
+    319, 323, 327, 331, 335, 339, 343, 347, 351, 353, 357,
+};
+
+static const uint8_t Font_3x5_Prop_advance[] = {
+    2, 2, 4, 4, 4, 4, 4, 2, 3, 3, 4, 4, 3, 4, 2, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 3, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 3, 4, 3, 4, 4,
+    3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 2, 4, 4,
+};
+
+const Font Font_3x5_Prop =
+{
+    0x20, 95, 6, 0, 0, FONT_RIGHT,
+    Font_3x5_Prop_data, Font_3x5_Prop_offset, Font_3x5_Prop_advance
+};
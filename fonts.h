@@ -0,0 +1,17 @@
+// Generated by tools/fontgen.py from Symbols.h -- do not edit.
+
+#ifndef FONTS_H
+#define FONTS_H
+
+#include "Font.h"
+
+extern const Font Font_5x8;         // 5x8, upright
+extern const Font Font_5x8_Prop;    // 5x8, prop
+extern const Font Font_5x8_Upside;  // 5x8, upside
+extern const Font Font_5x8_Mirror;  // 5x8, mirror
+extern const Font Font_5x8_Down;    // 5x8, down
+extern const Font Font_5x8_Up;      // 5x8, up
+extern const Font Font_3x5;         // 3x5, upright
+extern const Font Font_3x5_Prop;    // 3x5, prop
+
+#endif
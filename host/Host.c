@@ -0,0 +1,615 @@
+// Host build only: the CCS project compiles every .c file under its folder.
+#ifdef HOST_BUILD
+
+#include "Host.h"
+#include "../Clock.h"
+#include "../Nokia5110.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Registers are plain memory cells. A write cannot be seen when it happens,
+// so the cell returned by one access is examined at the start of the next
+// one (and by Host_Run). Write-only registers are preloaded with NOTWRITTEN
+// to tell a write from a read.
+#define CELLS       128
+#define NOTWRITTEN  0x80000000
+
+static struct
+{
+    uint32_t addr;
+    uint32_t value;
+} Cells[CELLS];
+static int CellCount = 0;
+
+static uint32_t *Pending = 0;               // Cell handed out by the last access
+static uint32_t PendingAddr, PendingBefore;
+
+static uint64_t Ticks = 0;
+
+// SSI0
+static uint8_t Fifo[8];
+static int FifoCount = 0;
+static bool Shifting = false;
+static int ShiftLeft;
+static uint8_t ShiftByte;
+
+// uDMA channel 11 and NVIC
+static const uint8_t *DmaSource;
+static uint32_t DmaLeft = 0;
+static uint32_t DmaStatus = 0;              // UDMA_CHIS_R
+static bool SSI0Enabled = false;            // NVIC_EN0 bit 7
+static bool GPIOFEnabled = false;           // NVIC_EN0 bit 30
+static bool InHandler = false;
+static bool Masked = false;                 // PRIMASK
+static uint32_t Taken = 0;                  // Handlers run so far
+
+// SysTick, counting system clock cycles
+static uint32_t SysTickCtrl = 0;            // NVIC_ST_CTRL_R
+static uint32_t SysTickReload = 0;          // NVIC_ST_RELOAD_R
+static int64_t SysTickLeft = 0;             // Cycles to the next wrap
+static bool SysTickPending = false;
+
+// GPIO ports B and F: PF4, PB0, PB1 and PB5 drive the keypad rows, PF0 to
+// PF3 read its columns
+static uint8_t PortB = 0, PortF = 0;        // Output latches
+static uint16_t (*Keypad)(void) = 0;        // Keys held, bit 4 * row + column
+static uint8_t PortFRIS = 0;                // GPIO_O_RIS of port F
+static uint8_t LastColumns = 0;             // Columns at the last edge check
+
+// Tick.c and Buttons.c, when they are linked in
+extern void SysTick_Handler(void) __attribute__((weak));
+extern void GPIOPortF_Handler(void) __attribute__((weak));
+
+// PCD8544
+static uint8_t Ram[SCREENBANKS][SCREENW];
+static int X = 0, Y = 0;
+static bool PowerDown = true, Vertical = false, Extended = false;
+static uint8_t Display = 0;                 // D and E bits of the display control command
+static int LastDC = -1;
+
+static HostCounters Counters;
+
+static uint32_t *cell(uint32_t addr)
+{
+    int i;
+
+    for(i = 0; i < CellCount; i = i + 1)
+        if(Cells[i].addr == addr)
+            return &Cells[i].value;
+
+    if(CellCount == CELLS)
+    {
+        fprintf(stderr, "host: too many registers\n");
+        return &Cells[0].value;
+    }
+
+    Cells[CellCount].addr = addr;
+    Cells[CellCount].value = 0;
+    return &Cells[CellCount++].value;
+}
+
+
+static void pcdreset(void)
+{
+    memset(Ram, 0, sizeof(Ram));
+    X = Y = 0;
+    PowerDown = true;
+    Vertical = Extended = false;
+    Display = 0;
+}
+
+
+// One byte arrives at the PCD8544
+static void pcdbyte(uint8_t byte, bool data)
+{
+    Counters.bytes++;
+    if((LastDC >= 0) && (LastDC != data))
+        Counters.dcToggles++;
+    LastDC = data;
+
+    if(data)
+    {
+        Counters.data++;
+        Ram[Y][X] = byte;
+
+        if(Vertical)
+        {
+            if(++Y == SCREENBANKS) { Y = 0; if(++X == SCREENW) X = 0; }
+        }
+        else
+        {
+            if(++X == SCREENW) { X = 0; if(++Y == SCREENBANKS) Y = 0; }
+        }
+        return;
+    }
+
+    Counters.commands++;
+
+    if((byte & 0xF8) == 0x20)               // Function set, in both instruction sets
+    {
+        PowerDown = (byte & 0x04) != 0;
+        Vertical = (byte & 0x02) != 0;
+        Extended = (byte & 0x01) != 0;
+    }
+    else if(!Extended)
+    {
+        if(byte & 0x80)
+        {
+            Counters.addressCommands++;
+            if((byte & 0x7F) < SCREENW) X = byte & 0x7F;
+        }
+        else if(byte & 0x40)
+        {
+            Counters.addressCommands++;
+            if((byte & 0x07) < SCREENBANKS) Y = byte & 0x07;
+        }
+        else if((byte & 0xF8) == 0x08)      // Display control
+            Display = ((byte >> 1) & 0x02) | (byte & 0x01);
+    }
+    // Extended set: Vop, bias and temperature coefficient only matter to the glass
+}
+
+
+// Data register of port B or F, at base + (pins << 2)
+static uint8_t *gpio(uint32_t addr)
+{
+    if((addr & ~0x3FF) == 0x40005000)
+        return &PortB;
+    if((addr & ~0x3FF) == 0x40025000)
+        return &PortF;
+    return 0;
+}
+
+
+// A column reads high when a held key joins it to a row that is driven high
+static uint8_t columns(void)
+{
+    uint16_t keys = Keypad ? Keypad() : 0;
+    uint8_t rows = ((PortF >> 4) & 0x01) | ((PortB & 0x03) << 1) | ((PortB >> 2) & 0x08);
+    uint8_t value = 0;
+    int row;
+
+    for(row = 0; row < 4; row = row + 1)
+        if(rows & (1 << row))
+            value |= (keys >> (4 * row)) & 0x0F;
+
+    return value;
+}
+
+
+// Edges on the columns since the last check raise the port F interrupt, as
+// GPIO_O_IS, IBE and IEV select. Level interrupts are not modeled.
+static void edges(void)
+{
+    uint8_t mask = *cell(0x40025410), now, changed;
+
+    if(!mask)
+        return;
+
+    now = columns();
+    changed = now ^ LastColumns;
+    LastColumns = now;
+
+    PortFRIS |= changed & ~*cell(0x40025404) & mask &
+                (*cell(0x40025408) | (*cell(0x4002540C) & now) | (~*cell(0x4002540C) & ~now));
+}
+
+
+// Advance the SSI and the uDMA by one tick
+static void tick(void)
+{
+    Ticks++;
+
+    if(SysTickCtrl & 0x01)
+    {
+        SysTickLeft = SysTickLeft - HOST_CYCLES_PER_TICK;
+        if(SysTickLeft <= 0)
+        {
+            SysTickLeft = SysTickLeft + SysTickReload + 1;
+            if(SysTickCtrl & 0x02)
+                SysTickPending = true;
+        }
+    }
+
+    if(DmaLeft && (*cell(0x40008024) & SSI_DMACTL_TXDMAE))
+    {
+        while(DmaLeft && (FifoCount < 8))
+        {
+            Fifo[FifoCount++] = *DmaSource++;
+            DmaLeft--;
+        }
+
+        if(DmaLeft == 0)
+            DmaStatus |= 1 << UDMA_CHANNEL_SSI0TX;
+    }
+
+    if(Shifting && (--ShiftLeft == 0))
+    {
+        pcdbyte(ShiftByte, *cell(0x40004100) == DC_DATA);   // DC is sampled with the eighth bit
+        Shifting = false;
+    }
+
+    if(!Shifting && FifoCount)
+    {
+        ShiftByte = Fifo[0];
+        memmove(Fifo, Fifo + 1, --FifoCount);
+        Shifting = true;
+        ShiftLeft = HOST_TICKS_PER_BYTE;
+    }
+}
+
+
+// Apply the last access if it was a write with side effects
+static void commit(void)
+{
+    uint32_t value, addr;
+
+    if(!Pending)
+        return;
+
+    value = *Pending;
+    addr = PendingAddr;
+    Pending = 0;
+
+    if(gpio(addr))
+    {
+        uint8_t mask = (addr >> 2) & 0xFF;
+
+        if(value != PendingBefore)
+            *gpio(addr) = (*gpio(addr) & ~mask) | (value & mask);
+        return;
+    }
+
+    switch(addr)
+    {
+        case 0x40008008:                    // SSI0_DR_R
+            if(value != NOTWRITTEN)
+            {
+                if(FifoCount < 8)
+                    Fifo[FifoCount++] = value;
+                else
+                    fprintf(stderr, "host: SSI0 FIFO overflow, byte 0x%02X lost\n", value & 0xFF);
+            }
+            break;
+
+        case 0x40004100:                    // DC
+            if((value != PendingBefore) && (FifoCount || Shifting))
+                Counters.dcGlitches++;
+            break;
+
+        case 0x40004200:                    // RESET
+            if((value == RESET_LOW) && (PendingBefore != RESET_LOW))
+                pcdreset();
+            break;
+
+        case 0xE000E100:                    // NVIC_EN0_R
+            if(!(value & NOTWRITTEN) && (value & NVIC_EN0_SSI0))
+                SSI0Enabled = true;
+            if(!(value & NOTWRITTEN) && (value & (1 << 30)))
+                GPIOFEnabled = true;
+            break;
+
+        case 0xE000E180:                    // NVIC_DIS0_R
+            if(!(value & NOTWRITTEN) && (value & NVIC_EN0_SSI0))
+                SSI0Enabled = false;
+            break;
+
+        case 0xE000E010:                    // NVIC_ST_CTRL_R
+            if(!(SysTickCtrl & 0x01) && (value & 0x01))
+                SysTickLeft = SysTickReload + 1;
+            SysTickCtrl = value;
+            break;
+
+        case 0xE000E014:                    // NVIC_ST_RELOAD_R
+            SysTickReload = value & 0x00FFFFFF;
+            break;
+
+        case 0x40025410:                    // GPIO_O_IM of port F
+            if(!PendingBefore && value)
+                LastColumns = columns();
+            break;
+
+        case 0x4002541C:                    // GPIO_O_ICR of port F, write 1 to clear
+            if(!(value & NOTWRITTEN))
+                PortFRIS &= ~value;
+            break;
+
+        case 0x400FF504:                    // UDMA_CHIS_R, write 1 to clear
+            if(!(value & NOTWRITTEN))
+                DmaStatus &= ~value;
+            break;
+
+        case 0x400FF028:                    // UDMA_ENASET_R
+            if(!(value & NOTWRITTEN) && (value & (1 << UDMA_CHANNEL_SSI0TX)))
+            {
+                // The control table holds 32-bit addresses. On a 64-bit host the
+                // upper half is taken from the table itself, which is right for
+                // the frame buffers next to it in Nokia5110.c.
+                extern uint32_t DMAControlTable[128];
+                uint32_t *entry = &DMAControlTable[4 * UDMA_CHANNEL_SSI0TX];
+                uintptr_t high = (uintptr_t)DMAControlTable & ~(uintptr_t)0xFFFFFFFF;
+
+                DmaLeft = ((entry[2] >> UDMA_CHCTL_XFERSIZE_S) & 0x3FF) + 1;
+                DmaSource = (const uint8_t *)(high | entry[0]) - (DmaLeft - 1);
+            }
+            break;
+    }
+}
+
+
+// SSI0 asks for its handler: TX FIFO interrupt or the uDMA channel done
+static bool ssi0(void)
+{
+    uint32_t mask, control;
+    bool fifo;
+
+    if(!SSI0Enabled)
+        return false;
+
+    mask = *cell(0x40008014);
+    control = *cell(0x40008004);
+
+    if(control & SSI_CR1_EOT)
+        fifo = (FifoCount == 0) && !Shifting;
+    else
+        fifo = FifoCount <= 4;
+
+    return ((mask & SSI_IM_TXIM) && fifo) || (DmaStatus & (1 << UDMA_CHANNEL_SSI0TX));
+}
+
+
+static bool gpiof(void)
+{
+    return GPIOFEnabled && (PortFRIS & *cell(0x40025410)) && GPIOPortF_Handler;
+}
+
+
+// An interrupt would run now if PRIMASK allowed it
+static bool pending(void)
+{
+    return (SysTickPending && SysTick_Handler) || ssi0() || gpiof();
+}
+
+
+static void handler(void (*run)(void))
+{
+    InHandler = true;
+    run();
+    commit();
+    InHandler = false;
+    Taken++;
+}
+
+
+// Run SysTick_Handler, SSI0_Handler and GPIOPortF_Handler when the real chip
+// would
+static void interrupts(void)
+{
+    if(InHandler || Masked)
+        return;
+
+    // All at the same priority, the lower exception number wins
+    if(SysTickPending && SysTick_Handler)
+    {
+        SysTickPending = false;
+        handler(SysTick_Handler);
+    }
+
+    if(ssi0())
+        handler(SSI0_Handler);
+
+    if(gpiof())
+        handler(GPIOPortF_Handler);
+}
+
+
+// Every register access of the driver ends up here (REG32 in Nokia5110.h)
+volatile uint32_t *Host_Register(uint32_t addr)
+{
+    uint32_t *c;
+
+    commit();
+    tick();
+    interrupts();
+
+    c = cell(addr);
+    if(gpio(addr))
+        *c = ((gpio(addr) == &PortF) ? ((PortF & 0xF0) | columns()) : PortB) & (addr >> 2) & 0xFF;
+
+    switch(addr)
+    {
+        case 0x40008008:                    // Writes go to the FIFO
+        case 0xE000E100:
+        case 0xE000E180:
+        case 0x400FF028:
+            *c = NOTWRITTEN;
+            break;
+
+        case 0x4000800C:                    // SSI0_SR_R
+            *c = ((FifoCount < 8) ? SSI_SR_TNF : 0) | ((FifoCount || Shifting) ? SSI_SR_BSY : 0);
+            break;
+
+        case 0x400FF504:
+            *c = DmaStatus | NOTWRITTEN;
+            break;
+
+        case 0xE0001004:                    // DWT_CYCCNT_R
+            *c = (uint32_t)(Ticks * HOST_CYCLES_PER_TICK);
+            break;
+
+        case 0xE000E018:                    // NVIC_ST_CURRENT_R
+            *c = (uint32_t)(SysTickLeft - 1) & 0x00FFFFFF;
+            break;
+
+        case 0x40025414:                    // GPIO_O_RIS and GPIO_O_MIS of port F
+            *c = PortFRIS;
+            break;
+
+        case 0x40025418:
+            *c = PortFRIS & *cell(0x40025410);
+            break;
+
+        case 0x4002541C:
+            *c = NOTWRITTEN;
+            break;
+    }
+
+    Pending = c;
+    PendingAddr = addr;
+    PendingBefore = *c;
+    return c;
+}
+
+
+// Keys the keypad holds from now on, asked on every read of port F
+void Host_SetKeypad(uint16_t (*keys)(void))
+{
+    Keypad = keys;
+}
+
+
+// Let time pass without a register access (SPINWAIT in Nokia5110.c)
+void Host_Run(void)
+{
+    commit();
+    tick();
+    interrupts();
+}
+
+
+// Once the SSI, the uDMA and the interrupts have nothing left to do, skip
+// time up to end or to the next SysTick, whichever comes first
+static void idle(uint64_t end)
+{
+    uint64_t skip;
+
+    if(FifoCount || Shifting || DmaLeft || (DmaStatus & (1 << UDMA_CHANNEL_SSI0TX)) ||
+       (SSI0Enabled && (*cell(0x40008014) & SSI_IM_TXIM)) || (Ticks >= end))
+        return;
+
+    skip = end - Ticks;
+    if((SysTickCtrl & 0x01) && ((uint64_t)SysTickLeft / HOST_CYCLES_PER_TICK < skip))
+        skip = (uint64_t)SysTickLeft / HOST_CYCLES_PER_TICK;
+
+    Ticks = Ticks + skip;
+    if(SysTickCtrl & 0x01)
+        SysTickLeft = SysTickLeft - skip * HOST_CYCLES_PER_TICK;
+}
+
+
+// Let cycles CPU cycles pass (SysCtlDelay)
+void Host_Wait(uint64_t cycles)
+{
+    uint64_t end = Ticks + cycles / HOST_CYCLES_PER_TICK;
+
+    while(Ticks < end)
+    {
+        Host_Run();
+        idle(end);
+    }
+}
+
+
+// WFI: let time pass until an interrupt is pending, or has run if they are
+// not masked. Idle time is skipped a millisecond at most at a time, and the
+// keypad columns are checked for edges after each step.
+void Host_Sleep(void)
+{
+    uint32_t taken = Taken;
+
+    while(!pending() && (Taken == taken))
+    {
+        Host_Run();
+        edges();
+        if(!pending())
+            idle(Ticks + ClockTicksPerMs / HOST_CYCLES_PER_TICK);
+    }
+}
+
+
+// Set PRIMASK, return what it was. Interrupts pending when it clears run now.
+uint32_t Host_Mask(bool masked)
+{
+    bool was = Masked;
+
+    commit();
+    Masked = masked;
+    interrupts();
+
+    return was;
+}
+
+
+// Run until the queue, the uDMA and the SSI have nothing left to send
+void Host_Settle(void)
+{
+    Nokia5110_Flush();
+    Nokia5110_WaitFrameDone();
+}
+
+
+uint64_t Host_Cycles(void)
+{
+    return Ticks * HOST_CYCLES_PER_TICK;
+}
+
+
+HostCounters Host_Counters(void)
+{
+    return Counters;
+}
+
+
+void Host_ResetCounters(void)
+{
+    memset(&Counters, 0, sizeof(Counters));
+}
+
+
+// Pixel as the glass shows it, with the display control mode applied
+bool Host_Pixel(int x, int y)
+{
+    bool on = (Ram[y / 8][x] >> (y % 8)) & 1;
+
+    if(PowerDown)
+        return false;
+
+    switch(Display)
+    {
+        case 0:  return false;              // Blank
+        case 1:  return true;               // All segments on
+        case 3:  return !on;                // Inverse
+        default: return on;                 // Normal
+    }
+}
+
+
+// PCD8544 RAM, SCREENBANKS rows of SCREENW bytes like Screen[]
+const uint8_t *Host_PanelRAM(void)
+{
+    return &Ram[0][0];
+}
+
+
+// What the glass shows, as a plain PBM (P1) file: 1 is a dark pixel
+bool Host_WritePBM(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    int x, y;
+
+    if(!f)
+        return false;
+
+    fprintf(f, "P1\n%d %d\n", SCREENW, SCREENH);
+    for(y = 0; y < SCREENH; y = y + 1)
+    {
+        for(x = 0; x < SCREENW; x = x + 1)
+            fputc(Host_Pixel(x, y) ? '1' : '0', f);
+        fputc('\n', f);
+    }
+
+    return fclose(f) == 0;
+}
+
+#endif
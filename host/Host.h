@@ -0,0 +1,51 @@
+#ifndef HOST_H_
+#define HOST_H_
+
+// Host build of the LCD driver: Nokia5110.c runs on a PC against a software
+// model of the SSI0 FIFO, the uDMA channel 11, the NVIC and the PCD8544.
+//
+// Every register access goes through Host_Register, which advances the
+// model by one tick (10 CPU cycles). A byte takes 16 ticks to shift out,
+// like the 4 MHz SSI clock at 80 MHz. The PCD8544 samples DC when the last
+// bit of a byte arrives, as the chip does, so a DC change while bytes are
+// still queued in the FIFO corrupts them here too and is counted.
+//
+// The data registers of GPIO ports B and F model the 4x4 keypad: a column
+// reads high when a key held by the Host_SetKeypad callback joins it to a
+// row driven high. Edges on the columns raise the port F interrupt while
+// the CPU sleeps in Host_Sleep (WFI); Host_Mask stands for PRIMASK.
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define HOST_CYCLES_PER_TICK    10
+#define HOST_TICKS_PER_BYTE     16
+
+// What the panel received, since the last Host_ResetCounters
+typedef struct
+{
+    uint32_t bytes;                         // Bytes shifted out on SDIN
+    uint32_t commands;                      // ... with DC low
+    uint32_t data;                          // ... with DC high
+    uint32_t dcToggles;                     // DC level changes between consecutive bytes
+    uint32_t dcGlitches;                    // DC changed while the SSI was busy
+    uint32_t addressCommands;               // X and Y address commands (0x80 | x, 0x40 | y)
+} HostCounters;
+
+volatile uint32_t *Host_Register    (uint32_t addr);
+void Host_Run                       (void);
+void Host_Wait                      (uint64_t cycles);
+void Host_Sleep                     (void);
+uint32_t Host_Mask                  (bool masked);
+void Host_Settle                    (void);
+void Host_SetKeypad                 (uint16_t (*keys)(void));
+uint64_t Host_Cycles                (void);
+
+HostCounters Host_Counters          (void);
+void Host_ResetCounters             (void);
+
+bool Host_Pixel                     (int x, int y);
+const uint8_t *Host_PanelRAM        (void);
+bool Host_WritePBM                  (const char *path);
+
+#endif
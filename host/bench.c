@@ -0,0 +1,312 @@
+// Plays a scripted game with the real main.c on top of the host model and
+// reports what every screen transition cost on the wire: bytes, commands,
+// and the time the SSI needs to shift them out. Each transition is checked
+// against its budget, so a change that makes a screen heavier fails here.
+//
+// The share of each transition the CPU spent awake, out of WFI (Tick.c), is
+// printed next to it. The input-to-photon latency of every interaction
+// (Latency.c) follows, from the key edge to the end of the frame that
+// answered it. Then the time spent in each state of the game flow (State.c)
+// and the cycles its handlers took.
+//
+// Usage: bench [-u] [-r log] [budget file]
+//        -u rewrites the budget file with the measured values
+//        -r writes the keys and seeds of the game (Replay.c) for host/replay
+
+// Host build only: the CCS project compiles every .c file under its folder.
+#ifdef HOST_BUILD
+
+#include "Host.h"
+#include "../Buttons.h"
+#include "../Clock.h"
+#include "../Latency.h"
+#include "../Replay.h"
+#include "../State.h"
+#include "../Tick.h"
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <string.h>
+
+// main.c is built with -Dmain=game_main; in one gcc command that reaches
+// this file too
+#undef main
+int game_main(void);
+
+// A key held for hold ms, then nothing pressed for idle ms. The bytes sent
+// from the press until the next one are the cost of the transition.
+static const struct
+{
+    const char *name;
+    uint8_t key;
+    uint16_t hold;
+    uint16_t idle;
+} Script[] =
+{
+    {"boot",            BUTTON_NOT_PRESSED,   0, 1000},   // Init and the title screen
+    {"title-menu",      11,                 250, 1000},   // Any key leaves the title
+    {"menu-commands",   13,                 200, 1000},   // Instrucoes is selected
+    {"commands-howto",  13,                 200, 1000},
+    {"howto-menu",      13,                 200, 1000},
+    {"menu-cursor",     14,                 200, 1000},   // Cursor to Novo Jogo
+    {"menu-fight",      13,                 200, 2500},   // Walk-in and the first fight frame
+    {"skill-cursor-1",  14,                 100,  500},
+    {"skill-cursor-2",  14,                 100,  500},
+    {"skill-cursor-3",  14,                 100,  500},   // Back to the first skill
+    {"round-1",         13,                 100, 2500},   // Choices, versus, next fight frame
+    {"round-2",         13,                 100, 2500},
+    {"round-3",         13,                 100, 3000},   // Victory and back to the menu
+};
+
+#define STEPS   (sizeof(Script) / sizeof(Script[0]))
+
+static uint32_t Start[STEPS];               // Press time of every step, ms
+static HostCounters Measured[STEPS];
+static TickDuty Duty[STEPS];
+static unsigned Step = 0;
+static jmp_buf Done;
+
+
+static uint32_t now(void)
+{
+    return (uint32_t)(Host_Cycles() / ClockTicksPerMs);
+}
+
+
+// Close the steps whose time is over; leave the game after the last one
+static void advance(void)
+{
+    uint32_t t = now();
+
+    while((Step + 1 < STEPS) ? (t >= Start[Step + 1]) : (t >= Start[Step] + Script[Step].hold + Script[Step].idle))
+    {
+        Measured[Step] = Host_Counters();
+        Host_ResetCounters();
+        Tick_Duty(&Duty[Step]);
+        Tick_DutyReset();
+
+        if(++Step == STEPS)
+            longjmp(Done, 1);
+    }
+}
+
+
+// The keypad plays the script. Buttons.c scans it from a scheduler task, so this is
+// also where the steps move on.
+static uint16_t keys(void)
+{
+    uint8_t key;
+
+    advance();
+
+    key = Script[Step].key;
+    if((key == BUTTON_NOT_PRESSED) || (now() >= Start[Step] + Script[Step].hold))
+        return 0;
+
+    return 1 << (4 * (key / 10 - 1) + (key % 10 - 1));
+}
+
+
+// Histogram of each interaction, in LATENCY_BUCKET_MS buckets
+static void latency(void)
+{
+    const LatencyStats *s;
+    unsigned i, b;
+
+    printf("\n%-16s %6s %5s %5s %5s", "interaction", "count", "min", "max", "mean");
+    for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+        printf(" %4u", b * LATENCY_BUCKET_MS);
+    printf(" ms\n");
+
+    for(i = 0; i < LATENCY_INTERACTIONS; i = i + 1)
+    {
+        s = Latency_Stats(i);
+
+        printf("%-16s %6u %5u %5u %5u", Latency_Name(i), s->count, s->min, s->max,
+               s->count ? s->total / s->count : 0);
+        for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+            printf(" %4u", s->buckets[b]);
+        printf("\n");
+    }
+}
+
+
+// Time in each state of the game flow; handler cycles from the host DWT
+static void states(void)
+{
+    const StateStats *s;
+    uint32_t calls;
+    unsigned i;
+
+    printf("\n%-16s %7s %7s %7s %8s %8s\n", "state", "entries", "updates", "ms", "max", "mean");
+
+    for(i = 0; i < State_Count(); i = i + 1)
+    {
+        s = State_Stats(i);
+        calls = s->entries + s->updates;
+
+        printf("%-16s %7u %7u %7u %8u %8u\n", State_Name(i), s->entries, s->updates,
+               s->ms + ((i == State_Current()) ? State_Ms() : 0), s->max,
+               calls ? (uint32_t)(s->total / calls) : 0);
+    }
+}
+
+
+static bool load(const char *path, HostCounters *budget, bool *found)
+{
+    FILE *f = fopen(path, "r");
+    char line[128], name[64];
+    unsigned bytes, commands, i;
+
+    if(!f)
+        return false;
+
+    while(fgets(line, sizeof(line), f))
+    {
+        if((line[0] == '#') || (sscanf(line, "%63s %u %u", name, &bytes, &commands) != 3))
+            continue;
+
+        for(i = 0; i < STEPS; i = i + 1)
+            if(!strcmp(name, Script[i].name))
+            {
+                budget[i].bytes = bytes;
+                budget[i].commands = commands;
+                found[i] = true;
+            }
+    }
+
+    fclose(f);
+    return true;
+}
+
+
+// Same text as Replay_Export, 'x' on the console of the device
+static bool record(const char *path)
+{
+    const ReplayLog *log = Replay_Log();
+    FILE *f = fopen(path, "w");
+    unsigned i;
+
+    if(!f)
+        return false;
+
+    fprintf(f, "replay %u%s\n", log->count, log->full ? " full" : "");
+    for(i = 0; i < log->count; i = i + 1)
+        fprintf(f, "%c %10u %10u\n", (log->entries[i].type == REPLAY_KEYS) ? 'k' : 's',
+                log->entries[i].ms, log->entries[i].value);
+    fprintf(f, "end\n");
+
+    return fclose(f) == 0;
+}
+
+
+static bool save(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    unsigned i;
+
+    if(!f)
+        return false;
+
+    fprintf(f, "# Budgets for host/bench: transition, bytes, commands\n");
+    for(i = 0; i < STEPS; i = i + 1)
+        fprintf(f, "%-16s %6u %6u\n", Script[i].name, Measured[i].bytes, Measured[i].commands);
+
+    return fclose(f) == 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    HostCounters budget[STEPS];
+    bool found[STEPS] = {false}, update = false;
+    const char *path = "host/budgets.txt", *log = 0;
+    uint32_t t = 0, us;
+    unsigned i;
+    int errors = 0;
+
+    while(argc > 1)
+    {
+        if(!strcmp(argv[1], "-u"))
+            update = true;
+        else if(!strcmp(argv[1], "-r") && (argc > 2))
+        {
+            log = argv[2];
+            argc--;
+            argv++;
+        }
+        else
+            break;
+
+        argc--;
+        argv++;
+    }
+    if(argc > 1)
+        path = argv[1];
+
+    for(i = 0; i < STEPS; i = i + 1)
+    {
+        Start[i] = t;
+        t = t + Script[i].hold + Script[i].idle;
+    }
+
+    Host_SetKeypad(keys);
+    if(!setjmp(Done))
+        game_main();                        // Never returns, advance() jumps back
+
+    if(log && !record(log))
+    {
+        fprintf(stderr, "bench: cannot write %s\n", log);
+        return 1;
+    }
+
+    if(update)
+    {
+        if(!save(path))
+        {
+            fprintf(stderr, "bench: cannot write %s\n", path);
+            return 1;
+        }
+        return 0;
+    }
+
+    if(!load(path, budget, found))
+    {
+        fprintf(stderr, "bench: cannot read %s\n", path);
+        return 1;
+    }
+
+    printf("%-16s %6s %6s %6s %8s %6s %7s %s\n",
+           "transition", "bytes", "cmds", "dc", "us", "awake", "budget", "status");
+
+    for(i = 0; i < STEPS; i = i + 1)
+    {
+        const char *verdict = "ok";
+
+        // Shift time of the bytes alone, what the transition asks of the SSI
+        us = (uint32_t)((uint64_t)Measured[i].bytes * HOST_TICKS_PER_BYTE * HOST_CYCLES_PER_TICK * 1000 / ClockTicksPerMs);
+
+        if(!found[i])
+            verdict = "NO BUDGET";
+        else if((Measured[i].bytes > budget[i].bytes) || (Measured[i].commands > budget[i].commands))
+            verdict = "OVER";
+        else if(Measured[i].dcGlitches)
+            verdict = "DC GLITCH";
+
+        printf("%-16s %6u %6u %6u %8u %5.1f%% %7u %s\n", Script[i].name,
+               Measured[i].bytes, Measured[i].commands, Measured[i].dcToggles, us,
+               Duty[i].ms ? 100.0 * (Duty[i].ms - Duty[i].sleptMs) / Duty[i].ms : 0.0,
+               found[i] ? budget[i].bytes : 0, verdict);
+
+        if(strcmp(verdict, "ok"))
+            errors = errors + 1;
+    }
+
+    latency();
+    states();
+    printf("\nscheduler: %u late task periods, %u step overruns\n", TickLate, TickOverruns);
+
+    return errors ? 1 : 0;
+}
+
+#endif
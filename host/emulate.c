@@ -0,0 +1,143 @@
+// Draws the game's screens with the real Nokia5110.c on top of the host model
+// (Host.c), writes what the glass shows as one PBM per screen and prints what
+// each screen cost on the wire.
+//
+// Usage: emulate [output directory]
+
+// Host build only: the CCS project compiles every .c file under its folder.
+#ifdef HOST_BUILD
+
+#include "Host.h"
+#include "../Nokia5110.h"
+#include "../Clock.h"
+#include "../sprites.h"
+#include "../screens.h"
+
+#include <stdio.h>
+
+static void init(void)
+{
+    Clock_Init(CLOCK_80MHZ);
+    Nokia5110_Init();
+    Nokia5110_Clear();
+}
+
+static void title(void)
+{
+    Nokia5110_DrawCompressedImage(game_title_rle);
+}
+
+static void menu(void)
+{
+    Nokia5110_ClearBuffer();
+    Nokia5110_DrawSprite(5, 18, &Sprite_Cursor_Start_Menu);
+    Nokia5110_PrintString(14, 16, "Instrucoes");
+    Nokia5110_PrintString(14, 24, "Novo Jogo");
+    Nokia5110_DisplayBuffer();
+}
+
+static void menucursor(void)
+{
+    Nokia5110_ClearBuffer();
+    Nokia5110_DrawSprite(5, 18 + 5, &Sprite_Cursor_Start_Menu);
+    Nokia5110_PrintString(14, 16, "Instrucoes");
+    Nokia5110_PrintString(14, 24, "Novo Jogo");
+    Nokia5110_DisplayBuffer();
+}
+
+static void fight(void)
+{
+    Nokia5110_ClearBuffer();
+    Nokia5110_DrawSprite(15, 32, &Sprite_Skill_Cursor);
+    Nokia5110_DrawSprite(0, 1, &Sprite_FullHP_Bar);
+    Nokia5110_DrawSpriteMasked(7, 9, &Sprite_Ryu, &Sprite_Ryu_mask);
+    Nokia5110_DrawSprite(52, 1, &Sprite_FullHP_Bar);
+    Nokia5110_DrawSpriteMasked(63, 9, &Sprite_Zangief, &Sprite_Zangief_mask);
+    Nokia5110_DrawSprite(17, 34, &Sprite_SKILL_1);
+    Nokia5110_DrawSprite(34, 34, &Sprite_SKILL_2);
+    Nokia5110_DrawSprite(34 + 17, 34, &Sprite_SKILL_3);
+    Nokia5110_DisplayBufferAsync();
+}
+
+static void fightcursor(void)
+{
+    Nokia5110_DrawSpriteMode(15, 32, &Sprite_Skill_Cursor, BLIT_XOR);
+    Nokia5110_DrawSpriteMode(15 + 17, 32, &Sprite_Skill_Cursor, BLIT_XOR);
+    Nokia5110_DisplayBufferAsync();
+}
+
+static void choice(void)
+{
+    Nokia5110_ClearBuffer();
+    Nokia5110_DrawSprite(10, 15, &Sprite_SKILL_2_TEMP);
+    Nokia5110_DrawSprite(55, 15, &Sprite_SKILL_3_TEMP);
+    Nokia5110_DisplayBuffer();
+}
+
+static void versus(void)
+{
+    Nokia5110_DrawSprite(32, 15, &Sprite_VERSUS);
+    Nokia5110_DisplayBuffer();
+}
+
+static void victory(void)
+{
+    Nokia5110_DrawCompressedImage(FINAL_VITORIA_rle);
+}
+
+static const struct
+{
+    const char *name;
+    void (*draw)(void);
+} Screens[] =
+{
+    {"init",        init},
+    {"title",       title},
+    {"menu",        menu},
+    {"menucursor",  menucursor},
+    {"fight",       fight},
+    {"fightcursor", fightcursor},
+    {"choice",      choice},
+    {"versus",      versus},
+    {"victory",     victory},
+};
+
+int main(int argc, char **argv)
+{
+    const char *dir = (argc > 1) ? argv[1] : ".";
+    char path[256];
+    HostCounters c;
+    uint64_t start;
+    int i, errors = 0;
+
+    printf("%-12s %6s %6s %6s %6s %6s %8s %8s\n",
+           "screen", "bytes", "cmds", "data", "addr", "dc", "glitches", "us");
+
+    for(i = 0; i < (int)(sizeof(Screens) / sizeof(Screens[0])); i = i + 1)
+    {
+        Host_ResetCounters();
+        start = Host_Cycles();
+
+        Screens[i].draw();
+        Host_Settle();
+
+        c = Host_Counters();
+        printf("%-12s %6u %6u %6u %6u %6u %8u %8u\n", Screens[i].name,
+               c.bytes, c.commands, c.data, c.addressCommands, c.dcToggles, c.dcGlitches,
+               (unsigned)((Host_Cycles() - start) / 80));
+
+        snprintf(path, sizeof(path), "%s/%s.pbm", dir, Screens[i].name);
+        if(!Host_WritePBM(path))
+        {
+            fprintf(stderr, "emulate: cannot write %s\n", path);
+            errors = errors + 1;
+        }
+
+        if(c.dcGlitches)
+            errors = errors + 1;
+    }
+
+    return errors ? 1 : 0;
+}
+
+#endif
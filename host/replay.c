@@ -0,0 +1,169 @@
+// Plays a recorded session with the real main.c on top of the host model:
+// the keys and the seeds come from the log (Replay.c) instead of the keypad
+// and the RTC. Logs come from 'x' on the profiler console of the device or
+// from bench -r. Prints what the session sent on the wire and its input
+// latencies, and writes the last screen as a PBM.
+//
+// Usage: replay log [screen.pbm]
+//        replay -c name log        prints the log as C source of a const
+//                                  ReplayLog, for a device build with
+//                                  -DREPLAY_SESSION=name
+
+// Host build only: the CCS project compiles every .c file under its folder.
+#ifdef HOST_BUILD
+
+#include "Host.h"
+#include "../Clock.h"
+#include "../Tick.h"
+#include "../Latency.h"
+#include "../Replay.h"
+
+#include <setjmp.h>
+#include <stdio.h>
+#include <string.h>
+
+// main.c is built with -Dmain=game_main; in one gcc command that reaches
+// this file too
+#undef main
+int game_main(void);
+
+#define REPLAY_TAIL_MS  3000                // Run on after the last entry, for its screens
+
+static ReplayLog Session;
+static uint32_t End;                        // TickMs to stop at
+static jmp_buf Done;
+
+
+static bool load(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[128], type, flag[8];
+    unsigned ms, value;
+
+    if(!f)
+        return false;
+
+    Session.count = 0;
+    Session.full = false;
+
+    while(fgets(line, sizeof(line), f))
+    {
+        if(sscanf(line, "replay %u %7s", &value, flag) == 2)
+            Session.full = !strcmp(flag, "full");
+
+        if((sscanf(line, " %c %u %u", &type, &ms, &value) != 3) || ((type != 'k') && (type != 's')))
+            continue;
+
+        if(Session.count == REPLAY_ENTRIES)
+            break;
+
+        Session.entries[Session.count].ms = ms;
+        Session.entries[Session.count].value = value;
+        Session.entries[Session.count].type = (type == 'k') ? REPLAY_KEYS : REPLAY_SEED;
+        Session.count = Session.count + 1;
+    }
+
+    fclose(f);
+    return true;
+}
+
+
+static void source(const char *name)
+{
+    unsigned i;
+
+    printf("// Recorded session, from host/replay -c. Build with -DREPLAY_SESSION=%s\n", name);
+    printf("#include \"Replay.h\"\n\n");
+    printf("const ReplayLog %s =\n{\n    %u, %s,\n    {\n", name, Session.count, Session.full ? "true" : "false");
+
+    for(i = 0; i < Session.count; i = i + 1)
+        printf("        {%u, %u, %s},\n", Session.entries[i].ms, Session.entries[i].value,
+               (Session.entries[i].type == REPLAY_KEYS) ? "REPLAY_KEYS" : "REPLAY_SEED");
+
+    printf("    }\n};\n");
+}
+
+
+// Nothing is held on the host keypad, Buttons_Tick takes the keys from the
+// log. Asked on every scan, so this is also where the session ends.
+static uint16_t keys(void)
+{
+    if((int32_t)(TickMs - End) >= 0)
+        longjmp(Done, 1);
+
+    return 0;
+}
+
+
+int main(int argc, char **argv)
+{
+    const char *pbm = "replay.pbm";
+    const LatencyStats *s;
+    HostCounters c;
+    unsigned i, b;
+
+    if((argc == 4) && !strcmp(argv[1], "-c"))
+    {
+        if(!load(argv[3]))
+        {
+            fprintf(stderr, "replay: cannot read %s\n", argv[3]);
+            return 1;
+        }
+
+        source(argv[2]);
+        return 0;
+    }
+
+    if(argc < 2)
+    {
+        fprintf(stderr, "usage: replay log [screen.pbm] | replay -c name log\n");
+        return 1;
+    }
+    if(argc > 2)
+        pbm = argv[2];
+
+    if(!load(argv[1]))
+    {
+        fprintf(stderr, "replay: cannot read %s\n", argv[1]);
+        return 1;
+    }
+    if(Session.full)
+        fprintf(stderr, "replay: the log was full, the session ends early\n");
+
+    End = (Session.count ? Session.entries[Session.count - 1].ms : 0) + REPLAY_TAIL_MS;
+
+    Replay_Play(&Session);                  // main's Replay_Record leaves it playing
+    Host_SetKeypad(keys);
+    if(!setjmp(Done))
+        game_main();                        // Never returns, keys() jumps back
+
+    c = Host_Counters();
+    printf("%u entries, %u ms: %u bytes, %u commands, %u dc toggles, %u dc glitches\n",
+           Session.count, End, c.bytes, c.commands, c.dcToggles, c.dcGlitches);
+
+    printf("\n%-16s %6s %5s %5s %5s", "interaction", "count", "min", "max", "mean");
+    for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+        printf(" %4u", b * LATENCY_BUCKET_MS);
+    printf(" ms\n");
+
+    for(i = 0; i < LATENCY_INTERACTIONS; i = i + 1)
+    {
+        s = Latency_Stats(i);
+
+        printf("%-16s %6u %5u %5u %5u", Latency_Name(i), s->count, s->min, s->max,
+               s->count ? s->total / s->count : 0);
+        for(b = 0; b < LATENCY_BUCKETS; b = b + 1)
+            printf(" %4u", s->buckets[b]);
+        printf("\n");
+    }
+
+    if(!Host_WritePBM(pbm))
+    {
+        fprintf(stderr, "replay: cannot write %s\n", pbm);
+        return 1;
+    }
+
+    return c.dcGlitches ? 1 : 0;
+}
+
+#endif
@@ -0,0 +1,186 @@
+// Host build only: the CCS project compiles every .c file under its folder.
+#ifdef HOST_BUILD
+
+// The few TivaWare calls the game makes, for running it on the host. The
+// headers in host/tivaware/ stand in for the real ones. SysTick, the NVIC
+// and the GPIO registers are accessed like the real driverlib does, Host.c
+// models the timer, the keypad and its interrupt behind them. PRIMASK and
+// WFI are calls into the model.
+
+#include "Host.h"
+#include "tivaware/driverlib/cpu.h"
+#include "tivaware/driverlib/interrupt.h"
+#include "tivaware/driverlib/sysctl.h"
+#include "tivaware/driverlib/gpio.h"
+#include "tivaware/driverlib/hibernate.h"
+#include "tivaware/driverlib/systick.h"
+
+// The RTC always reads the same second, so Escolha_Aleatoria makes the
+// same choice on every run and the scripted games are reproducible.
+#define HOST_RTC_SECONDS    1
+
+
+void SysCtlClockSet(uint32_t config)
+{
+}
+
+
+// 3 cycles per loop, like the real one
+void SysCtlDelay(uint32_t count)
+{
+    Host_Wait(3 * (uint64_t)count);
+}
+
+
+void SysCtlPeripheralEnable(uint32_t peripheral)
+{
+}
+
+
+void GPIOPinTypeGPIOInput(uint32_t port, uint8_t pins)
+{
+}
+
+
+void GPIOPinTypeGPIOOutput(uint32_t port, uint8_t pins)
+{
+}
+
+
+void GPIOPadConfigSet(uint32_t port, uint8_t pins, uint32_t strength, uint32_t type)
+{
+}
+
+
+// The pins select the bits through address lines 9:2, like GPIO_O_DATA
+int32_t GPIOPinRead(uint32_t port, uint8_t pins)
+{
+    return *Host_Register(port + ((uint32_t)pins << 2));
+}
+
+
+void GPIOPinWrite(uint32_t port, uint8_t pins, uint8_t value)
+{
+    *Host_Register(port + ((uint32_t)pins << 2)) = value;
+}
+
+
+static void setpins(uint32_t addr, uint8_t pins, bool set)
+{
+    if(set)
+        *Host_Register(addr) |= pins;
+    else
+        *Host_Register(addr) &= ~pins;
+}
+
+
+// Bit 0 of the type is both edges, bit 1 level, bit 2 rising or high
+void GPIOIntTypeSet(uint32_t port, uint8_t pins, uint32_t type)
+{
+    setpins(port + 0x408, pins, type & 0x01);               // GPIO_O_IBE
+    setpins(port + 0x404, pins, type & 0x02);               // GPIO_O_IS
+    setpins(port + 0x40C, pins, type & 0x04);               // GPIO_O_IEV
+}
+
+
+void GPIOIntEnable(uint32_t port, uint32_t flags)
+{
+    *Host_Register(port + 0x410) |= flags;                  // GPIO_O_IM
+}
+
+
+void GPIOIntDisable(uint32_t port, uint32_t flags)
+{
+    *Host_Register(port + 0x410) &= ~flags;
+}
+
+
+void GPIOIntClear(uint32_t port, uint32_t flags)
+{
+    *Host_Register(port + 0x41C) = flags;                   // GPIO_O_ICR
+}
+
+
+// Interrupts 16 to 47 are enabled through NVIC_EN0_R
+void IntEnable(uint32_t interrupt)
+{
+    *Host_Register(0xE000E100) = 1 << (interrupt - 16);
+}
+
+
+// PRIMASK: a masked interrupt stays pending, and still ends a WFI
+uint32_t CPUcpsid(void)
+{
+    return Host_Mask(true);
+}
+
+
+uint32_t CPUcpsie(void)
+{
+    return Host_Mask(false);
+}
+
+
+void CPUwfi(void)
+{
+    Host_Sleep();
+}
+
+
+void SysTickPeriodSet(uint32_t period)
+{
+    *Host_Register(0xE000E014) = period - 1;                // NVIC_ST_RELOAD_R
+}
+
+
+uint32_t SysTickPeriodGet(void)
+{
+    return *Host_Register(0xE000E014) + 1;
+}
+
+
+uint32_t SysTickValueGet(void)
+{
+    return *Host_Register(0xE000E018);                      // NVIC_ST_CURRENT_R
+}
+
+
+void SysTickEnable(void)
+{
+    *Host_Register(0xE000E010) |= 0x05;                     // NVIC_ST_CTRL_R: ENABLE, CLK_SRC
+}
+
+
+void SysTickDisable(void)
+{
+    *Host_Register(0xE000E010) &= ~0x01;
+}
+
+
+void SysTickIntEnable(void)
+{
+    *Host_Register(0xE000E010) |= 0x02;                     // INTEN
+}
+
+
+void HibernateEnableExpClk(uint32_t clock)
+{
+}
+
+
+void HibernateRTCSet(uint32_t seconds)
+{
+}
+
+
+void HibernateRTCEnable(void)
+{
+}
+
+
+uint32_t HibernateRTCGet(void)
+{
+    return HOST_RTC_SECONDS;
+}
+
+#endif
@@ -0,0 +1,11 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef CPU_H_
+#define CPU_H_
+
+#include <stdint.h>
+
+uint32_t CPUcpsid       (void);
+uint32_t CPUcpsie       (void);
+void     CPUwfi         (void);
+
+#endif
@@ -0,0 +1,39 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef GPIO_H_
+#define GPIO_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_PIN_0              0x00000001
+#define GPIO_PIN_1              0x00000002
+#define GPIO_PIN_2              0x00000004
+#define GPIO_PIN_3              0x00000008
+#define GPIO_PIN_4              0x00000010
+#define GPIO_PIN_5              0x00000020
+#define GPIO_PIN_6              0x00000040
+#define GPIO_PIN_7              0x00000080
+
+#define GPIO_INT_PIN_0          0x00000001
+#define GPIO_INT_PIN_1          0x00000002
+#define GPIO_INT_PIN_2          0x00000004
+#define GPIO_INT_PIN_3          0x00000008
+
+#define GPIO_FALLING_EDGE       0x00000000
+#define GPIO_RISING_EDGE        0x00000004
+#define GPIO_BOTH_EDGES         0x00000001
+
+#define GPIO_STRENGTH_2MA       0x00000001
+#define GPIO_PIN_TYPE_STD_WPD   0x0000000C
+
+void    GPIOPinTypeGPIOInput    (uint32_t port, uint8_t pins);
+void    GPIOPinTypeGPIOOutput   (uint32_t port, uint8_t pins);
+void    GPIOPadConfigSet        (uint32_t port, uint8_t pins, uint32_t strength, uint32_t type);
+int32_t GPIOPinRead             (uint32_t port, uint8_t pins);
+void    GPIOPinWrite            (uint32_t port, uint8_t pins, uint8_t value);
+void    GPIOIntTypeSet          (uint32_t port, uint8_t pins, uint32_t type);
+void    GPIOIntEnable           (uint32_t port, uint32_t flags);
+void    GPIOIntDisable          (uint32_t port, uint32_t flags);
+void    GPIOIntClear            (uint32_t port, uint32_t flags);
+
+#endif
@@ -0,0 +1,13 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef HIBERNATE_H_
+#define HIBERNATE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void     HibernateEnableExpClk  (uint32_t clock);
+void     HibernateRTCSet        (uint32_t seconds);
+void     HibernateRTCEnable     (void);
+uint32_t HibernateRTCGet        (void);
+
+#endif
@@ -0,0 +1,9 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef INTERRUPT_H_
+#define INTERRUPT_H_
+
+#include <stdint.h>
+
+void IntEnable          (uint32_t interrupt);
+
+#endif
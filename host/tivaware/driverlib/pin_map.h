@@ -0,0 +1,5 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef PIN_MAP_H_
+#define PIN_MAP_H_
+
+#endif
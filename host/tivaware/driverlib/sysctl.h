@@ -0,0 +1,24 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef SYSCTL_H_
+#define SYSCTL_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define SYSCTL_SYSDIV_1         0x07800000
+#define SYSCTL_SYSDIV_4         0x01C00000
+#define SYSCTL_SYSDIV_2_5       0xC1000000
+#define SYSCTL_USE_PLL          0x00000000
+#define SYSCTL_USE_OSC          0x00003800
+#define SYSCTL_OSC_MAIN         0x00000000
+#define SYSCTL_XTAL_16MHZ       0x00000540
+
+#define SYSCTL_PERIPH_GPIOB     0xF0000801
+#define SYSCTL_PERIPH_GPIOF     0xF0000805
+#define SYSCTL_PERIPH_HIBERNATE 0xF0001400
+
+void SysCtlClockSet         (uint32_t config);
+void SysCtlDelay            (uint32_t count);
+void SysCtlPeripheralEnable (uint32_t peripheral);
+
+#endif
@@ -0,0 +1,15 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef SYSTICK_H_
+#define SYSTICK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+void     SysTickPeriodSet   (uint32_t period);
+uint32_t SysTickPeriodGet   (void);
+uint32_t SysTickValueGet    (void);
+void     SysTickEnable      (void);
+void     SysTickDisable     (void);
+void     SysTickIntEnable   (void);
+
+#endif
@@ -0,0 +1,18 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef HW_GPIO_H_
+#define HW_GPIO_H_
+
+#define GPIO_O_DATA             0x00000000
+#define GPIO_O_IS               0x00000404
+#define GPIO_O_IBE              0x00000408
+#define GPIO_O_IEV              0x0000040C
+#define GPIO_O_IM               0x00000410
+#define GPIO_O_RIS              0x00000414
+#define GPIO_O_MIS              0x00000418
+#define GPIO_O_ICR              0x0000041C
+#define GPIO_O_LOCK             0x00000520
+#define GPIO_O_CR               0x00000524
+
+#define GPIO_LOCK_KEY           0x4C4F434B
+
+#endif
@@ -0,0 +1,7 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef HW_INTS_H_
+#define HW_INTS_H_
+
+#define INT_GPIOF               46
+
+#endif
@@ -0,0 +1,9 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef HW_MEMMAP_H_
+#define HW_MEMMAP_H_
+
+#define GPIO_PORTA_BASE         0x40004000
+#define GPIO_PORTB_BASE         0x40005000
+#define GPIO_PORTF_BASE         0x40025000
+
+#endif
@@ -0,0 +1,8 @@
+// Host build stand-in for the TivaWare header of the same name (see host/tivaware.c)
+#ifndef HW_TYPES_H_
+#define HW_TYPES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#endif
@@ -1,334 +1,432 @@
-#include "bitmaps.h"
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+#include <stdlib.h>
+#include "inc/hw_types.h"
+#include "inc/hw_memmap.h"
+#include "driverlib/sysctl.h"
+#include "driverlib/hibernate.h"
+#include "Nokia5110.h"
+#include "sprites.h"
+#include "screens.h"
 #include "Buttons.h"
-
+#include "Clock.h"
+#include "Profile.h"
+#include "Tick.h"
+#include "Scene.h"
+#include "clips.h"
+#include "Latency.h"
+#include "Replay.h"
+#include "State.h"
+#include "moves.h"
+
+//build with -DREPLAY_SESSION=name and a log from host/replay -c to run a recorded session again
+#ifdef REPLAY_SESSION
+extern const ReplayLog REPLAY_SESSION;
+#endif
+
+//nodes of the fight scene: the fight, then the choices of a round
+enum {
+    NODE_CURSOR, NODE_HP1, NODE_HP2, NODE_RYU, NODE_ZANGIEF, NODE_SKILL1, NODE_SKILL2, NODE_SKILL3,
+    NODE_PLAYER_CHOICE, NODE_OPONENT_CHOICE, NODE_VERSUS
+};
+
+//one skill bar slot per move of the set the game plays, the build fails otherwise (tools/movegen.py)
+typedef char Skill_Bar_Fits_Moves[(MOVE_SKILLS == NODE_SKILL3 - NODE_SKILL1 + 1) ? 1 : -1];
+
+//only the cursor key repeats when held, a held confirm key must not go through screens
+static const ButtonTimings Keypad = {BUTTON_DEBOUNCE_MS, BUTTON_HOLD_MS, BUTTON_REPEAT_MS, BUTTON_BIT(14)};
+
+#define STEP_MS 5 //one pass of the main loop, the keypad is scanned as often
+#define WALK_MS 33 //walk-in frames, about 30 per second
+#define WALK_STEPS 26
+#define REVEAL_MS 1500
+#define RESULT_MS 1000
+
+//the fight scene is on the screen: the display task only flushes it then, the
+//full screen images are drawn straight on the glass and the buffer is stale
+bool Luta = false;
+
+//states of the game flow, in the order of the table below
+enum {
+    STATE_TITLE, STATE_MENU, STATE_INSTRUCTIONS, STATE_WALKIN, STATE_CHOOSE, STATE_REVEAL,
+    STATE_RESOLVE, STATE_RESULT, STATES
+};
+
+//what the states share: the menu, the fight and the round
+int Opcao; //menu option under the cursor, 0 Instrucoes, 1 Novo Jogo
+int Pagina; //page of the instructions
+int Passo; //frame of the walk-in
+TickTimer Espera; //next walk-in frame, end of the reveal and of the result
+int HP_BAR1, HP_BAR2;
+int HP_aux; //result of the last round for the player, MOVE_DRAW for the first
+int Cursor; //move under the cursor
+uint8_t Player_choice; //each player's turn choice, a move of Golpes
+uint8_t Oponent_choice; //each random turn choice
+
+//the moves the fighters play, and what each pair of them gives (tools/movegen.py)
+//the skill bar has room for three
+static const MoveSet* const Golpes = &MoveSet_Skills;
+
+void Apresenta(void);
+void Mostra(int, int, bool);
+void Desenha_Menu(int);
 void Atualiza_Luta(int, int);
-void Result_Screen(int);
-uint8_t* HP_Bars(int);
-uint8_t* Escolha(int, int);
-uint8_t* Escolha_Aleatoria(time_t, struct tm*, int);
-int Round(uint8_t*, uint8_t*);
-void Instructions();
-void Start_Fight();
+const Sprite* HP_Bars(int);
+uint8_t Escolha_Aleatoria(void);
+
+void Title_Enter(void);
+void Title_Update(void);
+void Menu_Enter(void);
+void Menu_Update(void);
+void Instructions_Enter(void);
+void Instructions_Update(void);
+void WalkIn_Enter(void);
+void WalkIn_Update(void);
+void Choose_Enter(void);
+void Choose_Update(void);
+void Choose_Exit(void);
+void Reveal_Enter(void);
+void Reveal_Update(void);
+void Resolve_Update(void);
+void Result_Enter(void);
+void Result_Update(void);
+
+//name, enter, update, exit, and whether the state only waits for keys
+static const StateDef Estados[STATES] = {
+    {"Title",        Title_Enter,        Title_Update,        0,           true},
+    {"Menu",         Menu_Enter,         Menu_Update,         0,           true},
+    {"Instructions", Instructions_Enter, Instructions_Update, 0,           true},
+    {"WalkIn",       WalkIn_Enter,       WalkIn_Update,       0,           false},
+    {"Choose",       Choose_Enter,       Choose_Update,       Choose_Exit, false},
+    {"Reveal",       Reveal_Enter,       Reveal_Update,       0,           false},
+    {"Resolve",      0,                  Resolve_Update,      0,           false},
+    {"Result",       Result_Enter,       Result_Update,       0,           false},
+};
 
 int main(void) {
+    TickStep passo;
+
 //------------Initial config------------
+    Clock_Init(CLOCK_80MHZ); //before anything that depends on the clock rate
+    Profile_Init(); //'p' on the UART0 console dumps the timings, 'l' the input latencies, 's' the states, 'r' clears them
+    Tick_Init(); //1 ms SysTick, moves the animations
+    Latency_Init(); //times every press up to the frame that answers it
+#ifdef REPLAY_SESSION
+    Replay_Play(&REPLAY_SESSION);
+#endif
+    Replay_Record(); //'x' on the console exports the keys and seeds of the session
     Nokia5110_Init();
     Nokia5110_Clear();
-    SysCtlClockSet(SYSCTL_SYSDIV_1|SYSCTL_USE_PLL|SYSCTL_OSC_MAIN|SYSCTL_XTAL_16MHZ);
+    Nokia5110_SetFrameRate(30);
     ConfigureButtons();
+    Buttons_SetTimings(&Keypad);
+
+    //the scheduler runs these whenever the game waits (Tick.c)
+    if(!Tick_Every(Buttons_Tick, BUTTON_SCAN_MS) ||
+       !Tick_Every(Anim_Tick, 1) ||
+       !Tick_Every(Apresenta, 1)){
+        while(1){} //more tasks than TICK_TASKS, the game would run without one
+    }
     Nokia5110_Clear();
 
-    //start game loop
+    //game loop: every handler returns at once, the wait is only here
+    State_Init(Estados, STATES, STATE_TITLE);
+    Tick_StepStart(&passo, STEP_MS);
     while(1){
-        //show title screen
-        while( GetButton() == BUTTON_NOT_PRESSED ){
-            Nokia5110_DrawFullImage(game_title);
-            SysCtlDelay( (SysCtlClockGet())/15 );
-        }
+        uint8_t estado = State_Current();
 
-        SysCtlDelay( (SysCtlClockGet())/15 );
-        while(1){
-        //game start menu
-            Nokia5110_Clear();
-            Nokia5110_ClearBuffer();
-            Nokia5110_PrintBMP(5, 25, Cursor_Start_Menu, 0);
-            Nokia5110_DisplayBuffer();
-
-            Nokia5110_SetCursor(2,2);
-            Nokia5110_OutString("Instrucoes");
-
-            Nokia5110_SetCursor(2,3);
-            Nokia5110_OutString("Novo Jogo");
-
-            int state = 5;
-            int loop = 1;
-
-            SysCtlDelay( (SysCtlClockGet())/20 );
-            while(GetButton() !=  13){ //confirm button SW3: first row, third column
-                SysCtlDelay( (SysCtlClockGet())/20 );
-                //wait for a selection in the game start menu
-
-                if(GetButton() == 14){ //skill choice button
-                    SysCtlDelay( (SysCtlClockGet())/20 );
-                    if(loop == 2){ //trocar pra 3
-                        state = 0; //trocar pra 5
-                        loop = 0; //trocar pra 1
-                    }
-
-                    Nokia5110_Clear();
-                    Nokia5110_ClearBuffer();
-
-                    Nokia5110_PrintBMP(5, 25 + state, Cursor_Start_Menu, 0);
-                    Nokia5110_DisplayBuffer();
-
-                    Nokia5110_SetCursor(2,2);
-                    Nokia5110_OutString("Instrucoes");
-
-                    Nokia5110_SetCursor(2,3);
-                    Nokia5110_OutString("Novo Jogo");
-
-                    loop++;
-                    state += 5;
-                }
-            }
-
-            SysCtlDelay( (SysCtlClockGet())/20 );
-
-            if(loop == 1){
-                //Instructions screen
-                Instructions();
-                SysCtlDelay( (SysCtlClockGet())/20 );
-            }
-
-            else if(loop == 2){
-                //Start Game Screen
-                Start_Fight();
-                SysCtlDelay( (SysCtlClockGet())/20 );
-            }
+        State_Update();
+        Profile_Poll();
+        Replay_Poll(); //'x' without the profiler
+
+        //the CPU sleeps until the keypad wakes it, or the console is polled again
+        if(State_Sleeps()){
+            Buttons_Sleep();
+            Tick_StepStart(&passo, STEP_MS);
         }
+        else if(State_Current() != estado)
+            Tick_StepStart(&passo, STEP_MS); //a new state is updated at once, then every STEP_MS
+        else
+            Tick_StepWait(&passo);
     }
 }
 
 
-// This function shows how to play the game
-void Instructions(){
-    Nokia5110_Clear();
-    Nokia5110_ClearBuffer();
-    Nokia5110_SetCursor(1,1);
-    Nokia5110_OutString("Commands");
+//title screen, any key goes on as soon as it is debounced
+void Title_Enter(void){
+    Nokia5110_DrawCompressedImage(game_title_rle);
+}
 
-    Nokia5110_SetCursor(0,3);
-    Nokia5110_OutString("SW3 -Confirm");
+void Title_Update(void){
+    if(Buttons_GetPress() == BUTTON_NOT_PRESSED)
+        return;
+    Latency_Input(LATENCY_TITLE, Buttons_PressMs());
+    State_Go(STATE_MENU);
+}
+
+//game start menu, every press is queued
+void Menu_Enter(void){
+    Opcao = 0;
+    Desenha_Menu(Opcao);
+}
 
-    Nokia5110_SetCursor(0,4);
-    Nokia5110_OutString("SW4 -Cursor");
+void Menu_Update(void){
+    int key = Buttons_GetPress();
 
-    SysCtlDelay( (SysCtlClockGet())/10 );
-    while(GetButton() != 13){
+    if(key == 14){ //skill choice button
+        Latency_Input(LATENCY_MENU_CURSOR, Buttons_PressMs());
+        Opcao = !Opcao;
+        Desenha_Menu(Opcao);
     }
+    else if(key == 13){ //confirm button SW3: first row, third column
+        Latency_Input(LATENCY_MENU_CONFIRM, Buttons_PressMs());
+        State_Go((Opcao == 0) ? STATE_INSTRUCTIONS : STATE_WALKIN);
+    }
+}
 
-    Nokia5110_Clear();
+//the whole menu is composed in the buffer and sent once
+void Desenha_Menu(int opcao){
+    Nokia5110_ClearBuffer();
+    Nokia5110_DrawSprite(5, 18 + 5*opcao, &Sprite_Cursor_Start_Menu);
+    Nokia5110_PrintString(14, 16, "Instrucoes");
+    Nokia5110_PrintString(14, 24, "Novo Jogo");
+    Nokia5110_DisplayBuffer();
+}
+
+//how to play: the commands, then the instructions screen
+void Instructions_Enter(void){
+    Pagina = 0;
     Nokia5110_ClearBuffer();
-    SysCtlDelay( (SysCtlClockGet())/10 );
-    Nokia5110_DrawFullImage(Instructions_screen);
+    Nokia5110_PrintString(7, 8, "Commands");
+    Nokia5110_PrintString(0, 24, "SW3 -Confirm");
+    Nokia5110_PrintString(0, 32, "SW4 -Cursor");
+    Nokia5110_DisplayBuffer();
+}
 
-    while(GetButton() != 13){
-        SysCtlDelay( (SysCtlClockGet())/20 );
+void Instructions_Update(void){
+    //the press that opened this screen was taken already, this waits for a new one
+    if(Buttons_GetPress() != 13)
+        return;
+    Latency_Input(LATENCY_MENU_CONFIRM, Buttons_PressMs());
+
+    if(Pagina == 0){
+        Nokia5110_DrawCompressedImage(Instructions_screen_rle);
+        Pagina = 1;
     }
+    else
+        State_Go(STATE_MENU);
 }
 
-void Start_Fight(){
+//a new fight: the fighters walk in from the edges
+void WalkIn_Enter(void){
     //-----------Time configuration --------
     // Used to get random moves for oponent
     time_t tempo = time(NULL);
-    struct tm* timePtr = localtime(&tempo);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_HIBERNATE);
-    HibernateEnableExpClk( SysCtlClockGet() );
+    HibernateEnableExpClk( ClockHz );
     HibernateRTCSet(tempo);
     HibernateRTCEnable();
-    int segundos = timePtr->tm_sec;
-
-    int HP_BAR1 = 0;
-    int HP_BAR2 = 0;
-    int HP_aux; //to help store data from whose player i need less the health points
-    uint8_t* Player_choice = 0; //each player's turn choice
-    uint8_t* Oponent_choice = 0; //each random turn choice
 
     //sets a new fight
     HP_BAR1 = 3;
     HP_BAR2 = 3;
+    HP_aux = MOVE_DRAW;
+
+    //the fight screen is a retained scene: a change only redraws the banks it touches
+    Scene_Reset();
+    Luta = true;
+    Scene_Node(NODE_CURSOR, &Sprite_Skill_Cursor, 0, 15, 32, 0);
+    Scene_Node(NODE_HP1, &Sprite_FullHP_Bar, 0, 0, 1, 1);
+    Scene_Node(NODE_HP2, &Sprite_FullHP_Bar, 0, 52, 1, 1);
+    Scene_Node(NODE_RYU, &Sprite_Ryu, &Sprite_Ryu_mask, -18, 9, 1);
+    Scene_Node(NODE_ZANGIEF, &Sprite_Zangief, &Sprite_Zangief_mask, 84, 9, 1);
+    Scene_Node(NODE_SKILL1, Golpes->moves[0].icon, 0, 17, 34, 2); //skill icons cover the cursor
+    Scene_Node(NODE_SKILL2, Golpes->moves[1].icon, 0, 34, 34, 2);
+    Scene_Node(NODE_SKILL3, Golpes->moves[2].icon, 0, 34+17, 34, 2);
+    Scene_Node(NODE_PLAYER_CHOICE, Golpes->moves[0].choice, 0, 10, 15, 1);
+    Scene_Node(NODE_OPONENT_CHOICE, Golpes->moves[0].choice, 0, 55, 15, 1);
+    Scene_Node(NODE_VERSUS, &Sprite_VERSUS, 0, 32, 15, 3);
+
+    Mostra(NODE_CURSOR, NODE_VERSUS, false);
+    Scene_Show(NODE_RYU, true);
+    Scene_Show(NODE_ZANGIEF, true);
+    Passo = 0;
+    Tick_TimerStart(&Espera, 0); //the first frame goes at once
+}
 
-    Nokia5110_Clear();
-    Nokia5110_ClearBuffer();
-
-    //starts fight
-    while(HP_BAR1!=0 && HP_BAR2!=0){
-
-        //call choices
-        Player_choice = Escolha(HP_BAR1, HP_BAR2);
-        Oponent_choice = Escolha_Aleatoria(tempo, timePtr, segundos);
-
-        //show skills choices, and get some delay to help user view
-        Nokia5110_DisplayBuffer();
-
-        //show skills transition
-        Nokia5110_PrintBMP(32, 30, VERSUS, 0);
-        Nokia5110_DisplayBuffer();
+//one frame every WALK_MS, the blitter draws the part that is on screen
+void WalkIn_Update(void){
+    if(!Tick_TimerExpired(&Espera))
+        return;
+    if(Passo == WALK_STEPS){
+        State_Go(STATE_CHOOSE);
+        return;
+    }
 
-        SysCtlDelay( (SysCtlClockGet())/2 );
+    Scene_Move(NODE_RYU, Passo - 18, 9);
+    Scene_Move(NODE_ZANGIEF, (Passo < 21) ? (84 - Passo) : 63, 9);
+    Scene_Render();
+    Nokia5110_DisplayBufferAsync();
+    Passo++;
+    Espera = Espera + WALK_MS; //from the deadline, a late frame does not push the next ones
+}
 
-        //decides round winner, and less round loser health points
-        HP_aux = Round(Player_choice, Oponent_choice);
-        if(HP_aux == 1)
-            HP_BAR2--;
-        else if(HP_aux == 0)
-            HP_BAR1--;
+//the player picks a skill while the fighters play the last round
+void Choose_Enter(void){
+    Buttons_Flush(); //presses made while the round was shown do not count
 
+    //from the choices back to the fight
+    Mostra(NODE_PLAYER_CHOICE, NODE_VERSUS, false);
+    Mostra(NODE_CURSOR, NODE_SKILL3, true);
+    Cursor = 0;
+    Scene_Move(NODE_CURSOR, 15, 32);
 
-        if(HP_BAR1 == 0)
-            Result_Screen(0);
+    //the round winner attacks and the loser is hit, then both go back to idle
+    Anim_Play(0, (HP_aux == MOVE_WIN) ? &Clip_RyuAttack : (HP_aux == MOVE_LOSE) ? &Clip_RyuHit : &Clip_RyuIdle, NODE_RYU, 7, 9);
+    Anim_Play(1, (HP_aux == MOVE_LOSE) ? &Clip_ZangiefAttack : (HP_aux == MOVE_WIN) ? &Clip_ZangiefHit : &Clip_ZangiefIdle, NODE_ZANGIEF, 63, 9);
 
-        else if(HP_BAR2 == 0)
-            Result_Screen(1);
-    }
+    //Atualiza_Luta draws what changed and sends only what changed on the glass
+    Atualiza_Luta(HP_BAR1, HP_BAR2);
 }
 
-//This function decides who won the round
-//0 for lose, 1 for win, 2 for draw
-int Round(uint8_t* player, uint8_t* oponent){
+//the display task sends what this drew
+void Choose_Update(void){
+    int key = Buttons_GetPress();
 
-    //player chooses first skill
-    if(player==SKILL_1 && oponent==SKILL_1){
-        return 2;
-    }
-    else if(player==SKILL_1 && oponent==SKILL_2){
-        return 0;
-    }
-    else if(player==SKILL_1 && oponent==SKILL_3){
-        return 1;
+    //the animation task moved a fighter to its next frame
+    if(Anim_Changed()){
+        Anim_Update();
+        Scene_Render();
     }
 
-    //player chooses second skill
-    if(player==SKILL_2 && oponent==SKILL_1){
-        return 1;
+    if(key == 14){ //skill choice button
+        Latency_Input(LATENCY_SKILL_CURSOR, Buttons_PressMs());
+        //only the banks under the old and the new cursor are drawn again
+        Cursor = (Cursor + 1) % Golpes->count;
+        Scene_Move(NODE_CURSOR, 15 + 17*Cursor, 32);
+        Scene_Render();
     }
-    else if(player==SKILL_2 && oponent==SKILL_2){
-        return 2;
-    }
-    else if(player==SKILL_2 && oponent==SKILL_3){
-        return 0;
-    }
-
-    //player chooses third skill
-    if(player==SKILL_3 && oponent==SKILL_1){
-        return 0;
-    }
-    else if(player==SKILL_3 && oponent==SKILL_2){
-        return 1;
-    }
-    else if(player==SKILL_3 && oponent==SKILL_3){
-        return 2;
+    else if(key == 13){ //confirm button SW3: first row, third column
+        Latency_Input(LATENCY_SKILL_CONFIRM, Buttons_PressMs());
+        State_Go(STATE_REVEAL);
     }
 }
 
-uint8_t* Escolha(int hp1, int hp2){
-    int state = 17;
-    int loop = 1;
+//hide the fight and keep the player choice
+void Choose_Exit(void){
+    Anim_StopAll();
+    Mostra(NODE_CURSOR, NODE_SKILL3, false);
+    Player_choice = Cursor;
+    Scene_Show(NODE_PLAYER_CHOICE, true);
+    Scene_SetSprite(NODE_PLAYER_CHOICE, Golpes->moves[Player_choice].choice, 0); //10,15
+}
 
-    SysCtlDelay( (SysCtlClockGet())/15 );
-    Nokia5110_Clear();
-    Nokia5110_ClearBuffer();
+//both choices, then the versus, shown for REVEAL_MS
+void Reveal_Enter(void){
+    Oponent_choice = Escolha_Aleatoria();
 
-    Nokia5110_PrintBMP(15, 47, Skill_Cursor, 0);
+    //show skills choices
+    Scene_Render();
     Nokia5110_DisplayBuffer();
-    Atualiza_Luta(hp1, hp2);
 
-    while(GetButton() !=  13){ //confirm button SW3: first row, third column
+    //show skills transition
+    Scene_Show(NODE_VERSUS, true);
+    Scene_Render();
+    Nokia5110_DisplayBuffer();
 
-        if(GetButton() == 14){ //skill choice button
-            if(loop == 3){
-                state = 0;
-                loop = 0;
-            }
-            Nokia5110_Clear();
-            Nokia5110_ClearBuffer();
+    Tick_TimerStart(&Espera, REVEAL_MS); //keys are still queued and the display still flushed meanwhile
+}
 
-            Nokia5110_PrintBMP(15 + state, 47, Skill_Cursor, 0);
-            Nokia5110_DisplayBuffer();
-            Atualiza_Luta(hp1, hp2);
+void Reveal_Update(void){
+    if(Tick_TimerExpired(&Espera))
+        State_Go(STATE_RESOLVE);
+}
 
-            loop++;
-            state+=17;
-        }
-    }
+//decides round winner, and less round loser health points, one load from the outcome table
+void Resolve_Update(void){
+    MoveOutcome golpe = Move_Resolve(Golpes, Player_choice, Oponent_choice);
 
-    //clear screen and return player choice
-    Nokia5110_Clear();
-    Nokia5110_ClearBuffer();
-    if(loop == 1){
-        Nokia5110_PrintBMP(10, 30, SKILL_1_TEMP, 0);
-        return SKILL_1;
-    }
-    else if(loop == 2){
-        Nokia5110_PrintBMP(10, 30, SKILL_2_TEMP, 0);
-        return SKILL_2;
-    }
-    else{
-        Nokia5110_PrintBMP(10, 30, SKILL_3_TEMP, 0); //10,30
-        return SKILL_3;
-    }
+    HP_aux = golpe.result;
+    if(HP_aux == MOVE_WIN)
+        HP_BAR2 = (HP_BAR2 > golpe.damage) ? HP_BAR2 - golpe.damage : 0;
+    else if(HP_aux == MOVE_LOSE)
+        HP_BAR1 = (HP_BAR1 > golpe.damage) ? HP_BAR1 - golpe.damage : 0;
 
+    State_Go((HP_BAR1 == 0 || HP_BAR2 == 0) ? STATE_RESULT : STATE_CHOOSE);
 }
 
-uint8_t* Escolha_Aleatoria(time_t tempo, struct tm* timePtr, int segundos){
-    int choice = 0;
-    //insert random generator
-    tempo = HibernateRTCGet();
-    timePtr = localtime( &tempo );
-
-    segundos = timePtr->tm_sec;
-    if(segundos%5 == 0)
-        choice = 1;
-    else if(segundos%2 == 0)
-        choice = 2;
+//victory or defeat for RESULT_MS, then the menu
+void Result_Enter(void){
+    Luta = false;
+    if(HP_BAR1 == 0)
+        Nokia5110_DrawCompressedImage(FINAL_DERROTA_rle);
     else
-        choice = 3;
+        Nokia5110_DrawCompressedImage(FINAL_VITORIA_rle);
+    Tick_TimerStart(&Espera, RESULT_MS);
+}
 
-    //returns random choice for oponent
-    if(choice==1){
-        Nokia5110_PrintBMP(55, 30, SKILL_1_TEMP, 0);
-        return SKILL_1;
-    }
-    else if (choice==2){
-        Nokia5110_PrintBMP(55, 30, SKILL_2_TEMP, 0);
-        return SKILL_2;
-    }
-    else{
-        Nokia5110_PrintBMP(55, 30, SKILL_3_TEMP, 0);
-        return SKILL_3;
-    }
+void Result_Update(void){
+    if(Tick_TimerExpired(&Espera))
+        State_Go(STATE_MENU);
 }
 
-void Atualiza_Luta(int hp1, int hp2){
+//the opponent's move, drawn from the RTC seconds
+uint8_t Escolha_Aleatoria(void){
+    uint8_t choice;
+    //insert random generator
+    time_t tempo = Replay_Seed(HibernateRTCGet()); //recorded, so a replay makes the same choices
+    struct tm* timePtr = localtime( &tempo );
 
-    //player fighter and his health points
-    Nokia5110_PrintBMP(0, 7, HP_Bars(hp1) , 0);
-    Nokia5110_PrintBMP(7, 32, Ryu, 0);
+    //returns random choice for oponent
+    choice = Move_Pick(Golpes, timePtr->tm_sec);
+    Scene_Show(NODE_OPONENT_CHOICE, true);
+    Scene_SetSprite(NODE_OPONENT_CHOICE, Golpes->moves[choice].choice, 0);
+    return choice;
+}
 
+//display task: sends what was drawn since the last frame, at the frame rate
+void Apresenta(void){
+    if(Luta)
+        Nokia5110_Present();
+}
 
-    //opponent fighter and his health points
-    Nokia5110_PrintBMP(52, 7, HP_Bars(hp2) , 0);
-    Nokia5110_PrintBMP(63, 32, Zangief, 0);
+//shows or hides the scene nodes first to last
+void Mostra(int first, int last, bool visible){
+    int id;
+    for(id = first; id <= last; id++)
+        Scene_Show(id, visible);
+}
 
-    //skills bar
-    Nokia5110_PrintBMP(17, 45, SKILL_1, 0);
-    Nokia5110_PrintBMP(34, 45, SKILL_2, 0);
-    Nokia5110_PrintBMP(34+17, 45, SKILL_3, 0);
+void Atualiza_Luta(int hp1, int hp2){
+    PROFILE_ZONE(PROFILE_FIGHTFRAME){ //drawing and sending, without the delay
+        //health points of both fighters
+        Scene_SetSprite(NODE_HP1, HP_Bars(hp1), 0);
+        Scene_SetSprite(NODE_HP2, HP_Bars(hp2), 0);
 
-    //show bitmaps on screen
-    Nokia5110_DisplayBuffer();
+        //fighters, in the frame their animation is at
+        Anim_Update();
 
-    SysCtlDelay( (SysCtlClockGet())/15 );
-}
+        //only the banks that changed since the last frame are drawn again
+        Scene_Render();
 
-void Result_Screen(int final){
-    Nokia5110_Clear();
-    if(final==0)
-        Nokia5110_DrawFullImage(FINAL_DERROTA);
-    else if(final==1)
-        Nokia5110_DrawFullImage(FINAL_VITORIA);
-    SysCtlDelay( (SysCtlClockGet())/3 );
+        //show bitmaps on screen, the uDMA fills the panel while we wait
+        Nokia5110_Present();
+    }
+    //no delay: the animations go on in the input loop
 }
 
-uint8_t* HP_Bars(int hp){
+const Sprite* HP_Bars(int hp){
     switch(hp){
     case 0:
-        return ZeroHP_Bar;
+        return &Sprite_ZeroHP_Bar;
     case 1:
-        return LowHP_Bar;
+        return &Sprite_LowHP_Bar;
     case 2:
-        return MedHP_Bar;
+        return &Sprite_MedHP_Bar;
     case 3:
-        return FullHP_Bar;
+        return &Sprite_FullHP_Bar;
+    default:
+        return &Sprite_ZeroHP_Bar;
     }
 }
@@ -0,0 +1,29 @@
+// Generated by tools/movegen.py -- do not edit.
+// Moves, outcome tables and opponent picks for Move_Resolve and Move_Pick.
+
+#include "moves.h"
+#include "sprites.h"
+
+static const Move MoveSet_Skills_moves[MOVE_SKILLS] = {
+    {&Sprite_SKILL_1, &Sprite_SKILL_1_TEMP},
+    {&Sprite_SKILL_2, &Sprite_SKILL_2_TEMP},
+    {&Sprite_SKILL_3, &Sprite_SKILL_3_TEMP},
+};
+
+// Row: the player's move, column: the opponent's
+static const MoveOutcome MoveSet_Skills_outcomes[MOVE_SKILLS * MOVE_SKILLS] = {
+    {MOVE_DRAW, 0}, {MOVE_LOSE, 1}, {MOVE_WIN, 1},    // MOVE_SKILL_1
+    {MOVE_WIN, 1}, {MOVE_DRAW, 0}, {MOVE_LOSE, 1},    // MOVE_SKILL_2
+    {MOVE_LOSE, 1}, {MOVE_WIN, 1}, {MOVE_DRAW, 0},    // MOVE_SKILL_3
+};
+
+static const uint8_t MoveSet_Skills_picks[60] = {
+    0, 2, 1, 2, 1, 0, 1, 2, 1, 2, 0, 2, 1, 2, 1, 0, 1, 2, 1, 2,
+    0, 2, 1, 2, 1, 0, 1, 2, 1, 2, 0, 2, 1, 2, 1, 0, 1, 2, 1, 2,
+    0, 2, 1, 2, 1, 0, 1, 2, 1, 2, 0, 2, 1, 2, 1, 0, 1, 2, 1, 2,
+};
+
+const MoveSet MoveSet_Skills =
+{
+    MOVE_SKILLS, MoveSet_Skills_moves, MoveSet_Skills_outcomes, MoveSet_Skills_picks
+};
@@ -0,0 +1,19 @@
+// Generated by tools/movegen.py -- do not edit.
+
+#ifndef MOVES_H
+#define MOVES_H
+
+#include "Move.h"
+
+// MoveSet_Skills: 3 moves
+enum
+{
+    MOVE_SKILL_1,
+    MOVE_SKILL_2,
+    MOVE_SKILL_3,
+    MOVE_SKILLS
+};
+
+extern const MoveSet MoveSet_Skills;
+
+#endif
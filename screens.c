@@ -0,0 +1,81 @@
+// Generated by tools/rle_screens.py from bitmaps.h -- do not edit.
+// Run-length encoded full screens, drawn with Nokia5110_DrawCompressedImage.
+
+#include "screens.h"
+
+const uint8_t game_title_rle[] = {    // 504 -> 289 bytes
+    0xBC, 0x00, 0x83, 0x80, 0x8E, 0x00, 0x11, 0xF8, 0x08, 0xE8, 0xA8, 0xA8, 0x28, 0x38, 0x00, 0x00,
+    0xF8, 0x08, 0xF8, 0x00, 0x00, 0xF8, 0x08, 0xE8, 0x28, 0x80, 0xA8, 0x12, 0xB8, 0x00, 0x00, 0xF8,
+    0x08, 0xF8, 0x80, 0xF8, 0x08, 0xF8, 0x00, 0x00, 0x38, 0x28, 0xE8, 0x08, 0xE8, 0x28, 0x38, 0x81,
+    0x00, 0x08, 0x80, 0xC0, 0x40, 0x60, 0x30, 0x18, 0x08, 0x0C, 0x06, 0x80, 0x02, 0x00, 0x03, 0x82,
+    0x01, 0x81, 0x00, 0x82, 0x01, 0x08, 0x03, 0x06, 0x04, 0x0C, 0x08, 0x08, 0x18, 0x30, 0xE0, 0x81,
+    0x00, 0x04, 0x3F, 0x20, 0x3E, 0x02, 0x03, 0x81, 0x00, 0x15, 0x3F, 0x20, 0x3F, 0x00, 0x00, 0x3F,
+    0x20, 0x2F, 0x28, 0x2B, 0x2E, 0x20, 0x3F, 0x00, 0x00, 0x3F, 0x20, 0x3E, 0x02, 0x3E, 0x20, 0x3F,
+    0x81, 0x00, 0x02, 0x3F, 0x20, 0x3F, 0x81, 0x00, 0x02, 0x7C, 0xC6, 0x03, 0x82, 0x00, 0x02, 0xE0,
+    0x30, 0x18, 0x83, 0x00, 0x01, 0xE0, 0x3E, 0x85, 0x00, 0x01, 0x1E, 0xF0, 0x85, 0x00, 0x01, 0x01,
+    0xFF, 0x83, 0x00, 0x02, 0xFF, 0x01, 0xFD, 0x80, 0x85, 0x05, 0x87, 0x00, 0x00, 0xFF, 0x01, 0xFF,
+    0x81, 0x80, 0x12, 0x00, 0x00, 0xFF, 0x01, 0xFF, 0x80, 0xFF, 0x01, 0xFF, 0x00, 0x00, 0xFF, 0x01,
+    0x01, 0xB5, 0xB5, 0x31, 0x4B, 0xCE, 0x82, 0x00, 0x09, 0x03, 0x0E, 0x38, 0x60, 0xC0, 0x80, 0x80,
+    0x87, 0xFC, 0xC0, 0x83, 0x00, 0x01, 0x0F, 0xF0, 0x86, 0x00, 0x01, 0x3F, 0xF0, 0x82, 0x20, 0x04,
+    0x30, 0x18, 0x0F, 0x39, 0xE0, 0x82, 0x00, 0x00, 0x03, 0x82, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03,
+    0x82, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x82, 0x02, 0x03, 0x03, 0x00, 0x00, 0x03, 0x82, 0x02,
+    0x01, 0x03, 0x01, 0x8B, 0x00, 0x03, 0x03, 0x02, 0x02, 0x06, 0x80, 0x04, 0x06, 0x06, 0x03, 0x01,
+    0x07, 0xEC, 0xB8, 0x18, 0x80, 0x08, 0x02, 0x0C, 0x06, 0x03, 0x80, 0x00, 0x06, 0xC0, 0x40, 0x70,
+    0x18, 0x0C, 0x04, 0x07, 0xBF, 0x00, 0x01, 0x01, 0x03, 0x83, 0x02, 0x00, 0x03, 0x80, 0x01, 0x83,
+    0x00,
+};
+
+const uint8_t Instructions_screen_rle[] = {    // 504 -> 228 bytes
+    0x92, 0x00, 0x00, 0xFC, 0x80, 0x40, 0x21, 0xFC, 0x00, 0xC0, 0x40, 0x40, 0xC0, 0x00, 0xFC, 0x40,
+    0x40, 0xC0, 0x00, 0x40, 0x00, 0xFC, 0x00, 0x40, 0x00, 0xC0, 0x40, 0x40, 0xFC, 0x00, 0xC0, 0x40,
+    0x40, 0xC0, 0x00, 0xC0, 0x40, 0x40, 0xFC, 0x00, 0x80, 0x80, 0x40, 0x02, 0x80, 0x00, 0x80, 0x80,
+    0x40, 0xA2, 0x00, 0x00, 0x07, 0x80, 0x00, 0x21, 0x07, 0x00, 0x07, 0x01, 0x01, 0x07, 0x00, 0x07,
+    0x04, 0x04, 0x07, 0x00, 0xE7, 0x20, 0x27, 0xA0, 0x27, 0x20, 0xA7, 0x24, 0x24, 0xE7, 0x00, 0x07,
+    0x01, 0x01, 0x07, 0x00, 0x07, 0x04, 0x04, 0x07, 0x00, 0x03, 0x80, 0x05, 0x01, 0x01, 0x00, 0x80,
+    0x05, 0x00, 0x03, 0xA8, 0x00, 0x13, 0xE0, 0xC0, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x00, 0x00,
+    0x0F, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x0F, 0x80, 0x00, 0x05, 0xFC, 0x7C, 0x3C,
+    0x7C, 0xCC, 0x84, 0xAB, 0x00, 0x04, 0x80, 0xF8, 0x80, 0x80, 0xF8, 0x81, 0x00, 0x81, 0x07, 0x01,
+    0x06, 0x04, 0x93, 0x00, 0x0E, 0x01, 0x03, 0x06, 0x0C, 0x00, 0x00, 0xF0, 0xE0, 0x60, 0x70, 0x38,
+    0x70, 0x60, 0xE0, 0xF0, 0x99, 0x00, 0x01, 0x1C, 0x12, 0x80, 0x11, 0x80, 0x10, 0x00, 0x1F, 0x80,
+    0x00, 0x01, 0x80, 0x80, 0x97, 0x00, 0x01, 0x20, 0x60, 0x81, 0xE0, 0x09, 0x00, 0x01, 0x07, 0x0F,
+    0x1F, 0x38, 0x1F, 0x0F, 0x07, 0x01, 0xA5, 0x00, 0x07, 0x01, 0x01, 0x03, 0x03, 0x06, 0x06, 0x0C,
+    0x0C, 0x81, 0x18, 0x85, 0x30, 0x81, 0x18, 0x09, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x01,
+    0x03, 0x07, 0x95, 0x00,
+};
+
+const uint8_t FINAL_DERROTA_rle[] = {    // 504 -> 230 bytes
+    0x8D, 0x00, 0x05, 0x80, 0x40, 0x20, 0x20, 0x40, 0x80, 0x80, 0x00, 0x05, 0x80, 0x40, 0x20, 0x20,
+    0x40, 0x80, 0x80, 0x00, 0x01, 0x80, 0x40, 0x86, 0x20, 0x01, 0x40, 0x80, 0x80, 0x00, 0x00, 0xC0,
+    0x80, 0x20, 0x00, 0xC0, 0x82, 0x00, 0x00, 0xC0, 0x80, 0x20, 0x00, 0xC0, 0xA0, 0x00, 0x11, 0x01,
+    0x02, 0x04, 0x08, 0x10, 0xE0, 0x01, 0x02, 0x01, 0xE0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0xFC, 0x82, 0x02, 0x00, 0xFC, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0xA5, 0x00, 0x00, 0x1F,
+    0x80, 0x10, 0x00, 0x1F, 0x84, 0x00, 0x01, 0x07, 0x08, 0x80, 0x10, 0x82, 0x11, 0x80, 0x10, 0x05,
+    0x08, 0x07, 0x00, 0x00, 0x07, 0x08, 0x80, 0x10, 0x82, 0x11, 0x80, 0x10, 0x01, 0x08, 0x07, 0x9F,
+    0x00, 0x00, 0xFF, 0x80, 0x01, 0x00, 0xFE, 0x85, 0x00, 0x04, 0xF8, 0x04, 0x02, 0x01, 0xE1, 0x82,
+    0x11, 0x14, 0xE1, 0x01, 0x02, 0x04, 0xF8, 0x00, 0x00, 0x7C, 0x82, 0x01, 0x31, 0x49, 0x49, 0x89,
+    0x09, 0x11, 0x12, 0x1C, 0x00, 0x00, 0xFF, 0x80, 0x01, 0x05, 0x79, 0x49, 0xC9, 0x09, 0x09, 0x0F,
+    0x9C, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x00, 0x8F, 0x82, 0x88, 0x07, 0xF8, 0x00, 0x00, 0x3F, 0x40,
+    0x80, 0x80, 0x87, 0x82, 0x88, 0x14, 0x87, 0x80, 0x80, 0x40, 0x3F, 0x00, 0x00, 0x70, 0x88, 0x89,
+    0x91, 0x92, 0xA4, 0xA4, 0xB9, 0x81, 0x82, 0x7C, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x05, 0x9E, 0x92,
+    0x93, 0x90, 0x90, 0xF0, 0xE1, 0x00,
+};
+
+const uint8_t FINAL_VITORIA_rle[] = {    // 504 -> 254 bytes
+    0x8D, 0x00, 0x05, 0x80, 0x40, 0x20, 0x20, 0x40, 0x80, 0x80, 0x00, 0x05, 0x80, 0x40, 0x20, 0x20,
+    0x40, 0x80, 0x80, 0x00, 0x01, 0x80, 0x40, 0x86, 0x20, 0x01, 0x40, 0x80, 0x80, 0x00, 0x00, 0xC0,
+    0x80, 0x20, 0x00, 0xC0, 0x82, 0x00, 0x00, 0xC0, 0x80, 0x20, 0x00, 0xC0, 0xA0, 0x00, 0x11, 0x01,
+    0x02, 0x04, 0x08, 0x10, 0xE0, 0x01, 0x02, 0x01, 0xE0, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00,
+    0xFF, 0x80, 0x00, 0x00, 0xFC, 0x82, 0x02, 0x00, 0xFC, 0x80, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFF,
+    0x80, 0x00, 0x00, 0xFF, 0x82, 0x00, 0x00, 0xFF, 0x80, 0x00, 0x00, 0xFF, 0x9C, 0x00, 0x80, 0x80,
+    0x83, 0x00, 0x00, 0x1F, 0x80, 0x10, 0x00, 0x1F, 0x84, 0x00, 0x05, 0x07, 0x08, 0x10, 0x90, 0x90,
+    0x91, 0x81, 0x11, 0x08, 0x10, 0x10, 0x90, 0x88, 0x87, 0x80, 0x00, 0x07, 0x08, 0x80, 0x10, 0x80,
+    0x91, 0x01, 0x11, 0x11, 0x80, 0x10, 0x01, 0x08, 0x07, 0x80, 0x80, 0x97, 0x00, 0x22, 0x0E, 0x11,
+    0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, 0x20, 0x40,
+    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x80, 0x40, 0x20, 0x11, 0x0E, 0x00, 0x00, 0xFE,
+    0x01, 0x81, 0x00, 0x05, 0x01, 0xFE, 0x00, 0x00, 0xFE, 0x01, 0x80, 0x00, 0x06, 0x01, 0x82, 0x04,
+    0x08, 0x10, 0x20, 0x3F, 0x80, 0x00, 0x01, 0x01, 0xFE, 0x9A, 0x00, 0x04, 0x01, 0x02, 0x04, 0x08,
+    0x10, 0x80, 0x20, 0x04, 0x10, 0x08, 0x04, 0x08, 0x10, 0x80, 0x20, 0x04, 0x10, 0x08, 0x04, 0x02,
+    0x01, 0x84, 0x00, 0x01, 0x0F, 0x10, 0x81, 0x20, 0x05, 0x10, 0x0F, 0x00, 0x00, 0x0F, 0x10, 0x81,
+    0x20, 0x05, 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x81, 0x20, 0x00, 0x3F, 0xDF, 0x00,
+};
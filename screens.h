@@ -0,0 +1,13 @@
+// Generated by tools/rle_screens.py from bitmaps.h -- do not edit.
+
+#ifndef SCREENS_H
+#define SCREENS_H
+
+#include <stdint.h>
+
+extern const uint8_t game_title_rle[];
+extern const uint8_t Instructions_screen_rle[];
+extern const uint8_t FINAL_DERROTA_rle[];
+extern const uint8_t FINAL_VITORIA_rle[];
+
+#endif
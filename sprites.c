@@ -0,0 +1,130 @@
+// Generated by tools/bmp2sprite.py from bitmaps.h -- do not edit.
+// 1bpp bank-aligned sprites, drawn with Nokia5110_DrawSprite.
+// *_mask sprites are silhouettes for Nokia5110_DrawSpriteMasked.
+
+#include "sprites.h"
+
+// Ryu: 18x24, 3 bank(s)
+static const uint8_t Ryu_data[] = {
+    0xC0, 0x30, 0xC8, 0x36, 0x77, 0x16, 0x37, 0xF6, 0x57, 0x16, 0x57, 0xF6, 0x37, 0x16, 0x77, 0x3E,
+    0xC0, 0x00, 0x00, 0x01, 0x82, 0x41, 0x22, 0x94, 0x48, 0x08, 0x72, 0x82, 0x72, 0x08, 0x48, 0x94,
+    0x22, 0x41, 0x80, 0x00, 0x00, 0x00, 0x01, 0x02, 0x22, 0x57, 0x4A, 0x42, 0x22, 0x1A, 0x22, 0x42,
+    0x4A, 0x57, 0x22, 0x01, 0x00, 0x00,
+};
+const Sprite Sprite_Ryu = {18, 24, Ryu_data};
+
+// Ryu_mask: 18x24, 3 bank(s)
+static const uint8_t Ryu_mask_data[] = {
+    0xC0, 0xF0, 0xF8, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE,
+    0xC0, 0x00, 0x00, 0x01, 0x83, 0xC1, 0xE3, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7,
+    0xE3, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x01, 0x03, 0x23, 0x77, 0x7F, 0x7F, 0x3F, 0x1F, 0x3F, 0x7F,
+    0x7F, 0x77, 0x23, 0x01, 0x00, 0x00,
+};
+const Sprite Sprite_Ryu_mask = {18, 24, Ryu_mask_data};
+
+// Zangief: 16x24, 3 bank(s)
+static const uint8_t Zangief_data[] = {
+    0x00, 0xC0, 0x30, 0x08, 0x04, 0x86, 0x1F, 0x1F, 0x1F, 0x86, 0x04, 0x08, 0x30, 0xC0, 0x00, 0x00,
+    0x06, 0x89, 0x5E, 0x30, 0x70, 0x59, 0xC8, 0xC8, 0xC8, 0x59, 0x70, 0x30, 0x5E, 0x89, 0x06, 0x00,
+    0x0E, 0x11, 0x50, 0xBE, 0x98, 0xB8, 0x78, 0x38, 0x78, 0xB8, 0x98, 0xBE, 0x50, 0x11, 0x0E, 0x00,
+};
+const Sprite Sprite_Zangief = {16, 24, Zangief_data};
+
+// Zangief_mask: 16x24, 3 bank(s)
+static const uint8_t Zangief_mask_data[] = {
+    0x00, 0xC0, 0xF0, 0xF8, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFC, 0xF8, 0xF0, 0xC0, 0x00, 0x00,
+    0x06, 0x8F, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x8F, 0x06, 0x00,
+    0x0E, 0x1F, 0x5F, 0xFF, 0xFF, 0xFF, 0x7F, 0x3F, 0x7F, 0xFF, 0xFF, 0xFF, 0x5F, 0x1F, 0x0E, 0x00,
+};
+const Sprite Sprite_Zangief_mask = {16, 24, Zangief_mask_data};
+
+// FullHP_Bar: 32x7, 1 bank(s)
+static const uint8_t FullHP_Bar_data[] = {
+    0x7F, 0x41, 0x77, 0x14, 0x77, 0x41, 0x7F, 0x00, 0x7F, 0x41, 0x75, 0x11, 0x0E, 0x00, 0x3E, 0x41,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x3E,
+};
+const Sprite Sprite_FullHP_Bar = {32, 7, FullHP_Bar_data};
+
+// MedHP_Bar: 32x7, 1 bank(s)
+static const uint8_t MedHP_Bar_data[] = {
+    0x7F, 0x41, 0x77, 0x14, 0x77, 0x41, 0x7F, 0x00, 0x7F, 0x41, 0x75, 0x11, 0x0E, 0x00, 0x3E, 0x41,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E,
+};
+const Sprite Sprite_MedHP_Bar = {32, 7, MedHP_Bar_data};
+
+// LowHP_Bar: 32x7, 1 bank(s)
+static const uint8_t LowHP_Bar_data[] = {
+    0x7F, 0x41, 0x77, 0x14, 0x77, 0x41, 0x7F, 0x00, 0x7F, 0x41, 0x75, 0x11, 0x0E, 0x00, 0x3E, 0x41,
+    0x5D, 0x5D, 0x5D, 0x5D, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E,
+};
+const Sprite Sprite_LowHP_Bar = {32, 7, LowHP_Bar_data};
+
+// ZeroHP_Bar: 32x7, 1 bank(s)
+static const uint8_t ZeroHP_Bar_data[] = {
+    0x7F, 0x41, 0x77, 0x14, 0x77, 0x41, 0x7F, 0x00, 0x7F, 0x41, 0x75, 0x11, 0x0E, 0x00, 0x3E, 0x41,
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3E,
+};
+const Sprite Sprite_ZeroHP_Bar = {32, 7, ZeroHP_Bar_data};
+
+// SKILL_1: 12x12, 2 bank(s)
+static const uint8_t SKILL_1_data[] = {
+    0xFF, 0x01, 0x01, 0x81, 0x81, 0x41, 0x21, 0x3D, 0x21, 0xFD, 0x01, 0xFF, 0x0F, 0x08, 0x0B, 0x0B,
+    0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x08, 0x0F,
+};
+const Sprite Sprite_SKILL_1 = {12, 12, SKILL_1_data};
+
+// SKILL_2: 12x12, 2 bank(s)
+static const uint8_t SKILL_2_data[] = {
+    0xFF, 0x01, 0x01, 0xF9, 0x89, 0xE9, 0x89, 0xE9, 0x89, 0xF9, 0x01, 0xFF, 0x0F, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x09, 0x09, 0x09, 0x08, 0x0F,
+};
+const Sprite Sprite_SKILL_2 = {12, 12, SKILL_2_data};
+
+// SKILL_3: 12x12, 2 bank(s)
+static const uint8_t SKILL_3_data[] = {
+    0xFF, 0x01, 0x01, 0x71, 0xF1, 0xD9, 0x0D, 0xD9, 0xF1, 0x71, 0x01, 0xFF, 0x0F, 0x08, 0x08, 0x08,
+    0x08, 0x09, 0x0B, 0x09, 0x08, 0x08, 0x08, 0x0F,
+};
+const Sprite Sprite_SKILL_3 = {12, 12, SKILL_3_data};
+
+// Skill_Cursor: 16x16, 2 bank(s)
+static const uint8_t Skill_Cursor_data[] = {
+    0x00, 0xFE, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0xFE, 0x00,
+    0x00, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7F, 0x00,
+};
+const Sprite Sprite_Skill_Cursor = {16, 16, Skill_Cursor_data};
+
+// Cursor_Start_Menu: 4x8, 1 bank(s)
+static const uint8_t Cursor_Start_Menu_data[] = {
+    0x7F, 0x3E, 0x1C, 0x08,
+};
+const Sprite Sprite_Cursor_Start_Menu = {4, 8, Cursor_Start_Menu_data};
+
+// SKILL_1_TEMP: 16x16, 2 bank(s)
+static const uint8_t SKILL_1_TEMP_data[] = {
+    0x54, 0xFE, 0x03, 0x02, 0x03, 0x02, 0x03, 0x82, 0xFB, 0x82, 0x83, 0x82, 0xFB, 0x02, 0xFF, 0xAA,
+    0x55, 0xFF, 0x40, 0xDC, 0x5E, 0xDE, 0x51, 0xD0, 0x50, 0xD0, 0x50, 0xD0, 0x5F, 0xC0, 0x7F, 0x2A,
+};
+const Sprite Sprite_SKILL_1_TEMP = {16, 16, SKILL_1_TEMP_data};
+
+// SKILL_2_TEMP: 16x16, 2 bank(s)
+static const uint8_t SKILL_2_TEMP_data[] = {
+    0x54, 0xFE, 0x03, 0xF2, 0x13, 0x12, 0xD3, 0x12, 0x13, 0xD2, 0x13, 0x12, 0xF3, 0x02, 0xFF, 0xAA,
+    0x55, 0xFF, 0x40, 0xC7, 0x44, 0xC4, 0x47, 0xC4, 0x44, 0xC7, 0x44, 0xC4, 0x47, 0xC0, 0x7F, 0x2A,
+};
+const Sprite Sprite_SKILL_2_TEMP = {16, 16, SKILL_2_TEMP_data};
+
+// SKILL_3_TEMP: 16x16, 2 bank(s)
+static const uint8_t SKILL_3_TEMP_data[] = {
+    0x54, 0xFE, 0x03, 0x02, 0xF3, 0xE2, 0xE3, 0x72, 0x3B, 0x72, 0xE3, 0xE2, 0xF3, 0x02, 0xFF, 0xAA,
+    0x55, 0xFF, 0x40, 0xC0, 0x40, 0xC3, 0x47, 0xCF, 0x5C, 0xCF, 0x47, 0xC3, 0x40, 0xC0, 0x7F, 0x2A,
+};
+const Sprite Sprite_SKILL_3_TEMP = {16, 16, SKILL_3_TEMP_data};
+
+// VERSUS: 20x16, 2 bank(s)
+static const uint8_t VERSUS_data[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x38, 0x7C, 0xFE, 0xEF, 0xE7, 0xC7, 0xC3,
+    0x80, 0x00, 0x00, 0x00, 0x0C, 0x1C, 0x38, 0x70, 0x3C, 0x1E, 0x07, 0x03, 0x01, 0x0C, 0x1C, 0x18,
+    0x18, 0x1D, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00,
+};
+const Sprite Sprite_VERSUS = {20, 16, VERSUS_data};
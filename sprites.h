@@ -0,0 +1,26 @@
+// Generated by tools/bmp2sprite.py from bitmaps.h -- do not edit.
+
+#ifndef SPRITES_H
+#define SPRITES_H
+
+#include "Nokia5110.h"
+
+extern const Sprite Sprite_Ryu;                     // 18x24
+extern const Sprite Sprite_Ryu_mask;                // 18x24
+extern const Sprite Sprite_Zangief;                 // 16x24
+extern const Sprite Sprite_Zangief_mask;            // 16x24
+extern const Sprite Sprite_FullHP_Bar;              // 32x7
+extern const Sprite Sprite_MedHP_Bar;               // 32x7
+extern const Sprite Sprite_LowHP_Bar;               // 32x7
+extern const Sprite Sprite_ZeroHP_Bar;              // 32x7
+extern const Sprite Sprite_SKILL_1;                 // 12x12
+extern const Sprite Sprite_SKILL_2;                 // 12x12
+extern const Sprite Sprite_SKILL_3;                 // 12x12
+extern const Sprite Sprite_Skill_Cursor;            // 16x16
+extern const Sprite Sprite_Cursor_Start_Menu;       // 4x8
+extern const Sprite Sprite_SKILL_1_TEMP;            // 16x16
+extern const Sprite Sprite_SKILL_2_TEMP;            // 16x16
+extern const Sprite Sprite_SKILL_3_TEMP;            // 16x16
+extern const Sprite Sprite_VERSUS;                  // 20x16
+
+#endif
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+"""
+Converts the 4bpp Windows BMP arrays of bitmaps.h into the 1bpp, bank-aligned
+Sprite format drawn by Nokia5110_DrawSprite.
+
+Each sprite is stored as ceil(height / 8) banks of 'width' bytes, the same
+layout as the PCD8544 RAM and Screen[]: byte [bank * width + x] holds the
+pixels of column x, rows bank*8 .. bank*8+7, LSB on top.
+
+A pixel is lit when its palette index is above the threshold, exactly as
+Nokia5110_PrintBMP(x, y, bmp, threshold) does.
+
+--mask NAME also emits Sprite_NAME_mask, the silhouette of the sprite: every
+pixel that is lit or enclosed by lit pixels (off pixels not reachable from the
+border). Nokia5110_DrawSpriteMasked clears the silhouette before drawing the
+sprite, so the dark outline and the holes inside a character cover whatever
+is behind it while the area around it stays transparent.
+
+Usage (from the project root, after editing bitmaps.h):
+    python3 tools/bmp2sprite.py [--threshold N] [--mask NAME ...] [bitmaps.h] [sprites]
+writes sprites.c and sprites.h and prints the flash saved per asset.
+"""
+
+import argparse
+import re
+import sys
+
+ARRAY = re.compile(r'const\s+(?:unsigned\s+char|uint8_t)\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', re.S)
+
+
+def parse_arrays(text):
+    for name, body in ARRAY.findall(text):
+        yield name, [int(tok, 16) for tok in re.findall(r'0[xX][0-9a-fA-F]+', body)]
+
+
+def u16(data, i):
+    return data[i] | (data[i + 1] << 8)
+
+
+def u32(data, i):
+    return u16(data, i) | (u16(data, i + 2) << 16)
+
+
+def decode_bmp(name, data, threshold):
+    """Returns (width, height, rows) with rows[y][x] in top-to-bottom order."""
+    offset, width, height, bpp = u32(data, 10), u32(data, 18), u32(data, 22), u16(data, 28)
+    if bpp != 4:
+        raise ValueError('%s: only 4bpp bitmaps are supported (got %d)' % (name, bpp))
+    if height & 0x80000000:
+        raise ValueError('%s: top-to-bottom bitmaps are not supported' % name)
+
+    stride = ((width * 4 + 31) // 32) * 4      # Rows are 32-bit word aligned
+    needed = offset + stride * height
+    if len(data) < needed:
+        print('warning: %s is %d bytes short, missing pixels are off' % (name, needed - len(data)),
+              file=sys.stderr)
+        data = data + [0] * (needed - len(data))
+
+    rows = []
+    for y in range(height):
+        line = offset + (height - 1 - y) * stride   # Bitmaps are stored bottom row first
+        row = []
+        for x in range(width):
+            byte = data[line + x // 2]
+            nibble = (byte >> 4) if (x % 2) == 0 else (byte & 0x0F)
+            row.append(nibble > threshold)
+        rows.append(row)
+    return width, height, rows
+
+
+def silhouette(width, height, rows):
+    """Lit pixels plus the off pixels that the border cannot reach (4-connected)."""
+    outside = [[False] * width for _ in range(height)]
+    todo = [(x, y) for y in range(height) for x in (0, width - 1)] + \
+           [(x, y) for x in range(width) for y in (0, height - 1)]
+    while todo:
+        x, y = todo.pop()
+        if x < 0 or y < 0 or x >= width or y >= height or outside[y][x] or rows[y][x]:
+            continue
+        outside[y][x] = True
+        todo += [(x + 1, y), (x - 1, y), (x, y + 1), (x, y - 1)]
+    return [[not outside[y][x] for x in range(width)] for y in range(height)]
+
+
+def pack(width, height, rows):
+    banks = (height + 7) // 8
+    out = []
+    for bank in range(banks):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                y = bank * 8 + bit
+                if y < height and rows[y][x]:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def c_bytes(data, indent='    ', per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ', '.join('0x%02X' % b for b in data[i:i + per_line]) + ',')
+    return '\n'.join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    ap.add_argument('source', nargs='?', default='bitmaps.h')
+    ap.add_argument('output', nargs='?', default='sprites', help='output base name (.c and .h are added)')
+    ap.add_argument('--threshold', type=int, default=0)
+    ap.add_argument('--mask', action='append', default=[], metavar='NAME',
+                    help='also emit Sprite_NAME_mask for Nokia5110_DrawSpriteMasked')
+    args = ap.parse_args()
+
+    with open(args.source) as f:
+        text = f.read()
+
+    sprites = []
+    for name, data in parse_arrays(text):
+        if data[:2] != [0x42, 0x4D]:            # Not a 'BM' file, e.g. the full-screen images
+            continue
+        width, height, rows = decode_bmp(name, data, args.threshold)
+        sprites.append((name, width, height, pack(width, height, rows), len(data)))
+        if name in args.mask:
+            sprites.append((name + '_mask', width, height, pack(width, height, silhouette(width, height, rows)), 0))
+
+    missing = set(args.mask) - set(s[0] for s in sprites)
+    if missing:
+        ap.error('--mask: no such bitmap: %s' % ', '.join(sorted(missing)))
+
+    src = ['// Generated by tools/bmp2sprite.py from %s -- do not edit.' % args.source,
+           '// 1bpp bank-aligned sprites, drawn with Nokia5110_DrawSprite.',
+           '// *_mask sprites are silhouettes for Nokia5110_DrawSpriteMasked.',
+           '',
+           '#include "%s.h"' % args.output.split('/')[-1],
+           '']
+    hdr = ['// Generated by tools/bmp2sprite.py from %s -- do not edit.' % args.source,
+           '',
+           '#ifndef SPRITES_H',
+           '#define SPRITES_H',
+           '',
+           '#include "Nokia5110.h"',
+           '']
+
+    total_bmp = total_spr = 0
+    print('%-20s %7s %8s %8s' % ('asset', 'size', 'bmp', 'sprite'))
+    for name, width, height, data, bmp_len in sprites:
+        src.append('// %s: %dx%d, %d bank(s)' % (name, width, height, (height + 7) // 8))
+        src.append('static const uint8_t %s_data[] = {' % name)
+        src.append(c_bytes(data))
+        src.append('};')
+        src.append('const Sprite Sprite_%s = {%d, %d, %s_data};' % (name, width, height, name))
+        src.append('')
+        hdr.append('extern const Sprite Sprite_%s;%s// %dx%d' % (name, ' ' * max(1, 24 - len(name)), width, height))
+
+        total_bmp += bmp_len
+        total_spr += len(data) + 8              # Data plus the Sprite descriptor
+        print('%-20s %3dx%-3d %8d %8d' % (name, width, height, bmp_len, len(data) + 8))
+
+    hdr += ['', '#endif', '']
+    print('%-20s %7s %8d %8d  (%.0f%%)' % ('total', '', total_bmp, total_spr, 100.0 * total_spr / total_bmp))
+
+    with open(args.output + '.c', 'w') as f:
+        f.write('\n'.join(src))
+    with open(args.output + '.h', 'w') as f:
+        f.write('\n'.join(hdr))
+
+
+if __name__ == '__main__':
+    main()
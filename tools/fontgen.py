@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+"""
+Generates the glyph tables drawn by Font.c: every font in every orientation the
+game asks for, so drawing turned or mirrored text costs the same table
+lookups as upright text.
+
+Fonts:
+    5x8  the ASCII table of Symbols.h (0x20 to 0x80), 7 pixels per character
+         with the blank column on either side that Nokia5110_OutChar adds
+    3x5  a small font defined below, 4 pixels per character; lowercase
+         letters print as capitals
+
+Each variant turns the upright glyphs once, here:
+    upright   left to right
+    prop      left to right, blank columns trimmed, 1 column between glyphs
+    upside    turned 180 degrees, runs right to left
+    mirror    flipped left to right, runs right to left
+    down      turned 90 degrees clockwise, runs top to bottom
+    up        turned 90 degrees counterclockwise, runs bottom to top
+
+Glyphs are stored like Sprite data (see tools/bmp2sprite.py): ceil(height / 8)
+banks of 'width' bytes, LSB on top.
+
+Usage (from the project root, after editing Symbols.h or the fonts below):
+    python3 tools/fontgen.py [Symbols.h] [fonts]
+writes fonts.c and fonts.h and prints the flash per font.
+"""
+
+import argparse
+import re
+import sys
+
+# 3x5 glyphs, rows top to bottom, '#' is a lit pixel
+SMALL = {
+    ' ': ['...', '...', '...', '...', '...'],
+    '!': ['.#.', '.#.', '.#.', '...', '.#.'],
+    '"': ['#.#', '#.#', '...', '...', '...'],
+    '#': ['#.#', '###', '#.#', '###', '#.#'],
+    '$': ['.##', '##.', '.#.', '.##', '##.'],
+    '%': ['#.#', '..#', '.#.', '#..', '#.#'],
+    '&': ['.#.', '#.#', '.#.', '#.#', '.##'],
+    "'": ['.#.', '.#.', '...', '...', '...'],
+    '(': ['..#', '.#.', '.#.', '.#.', '..#'],
+    ')': ['#..', '.#.', '.#.', '.#.', '#..'],
+    '*': ['...', '#.#', '.#.', '#.#', '...'],
+    '+': ['...', '.#.', '###', '.#.', '...'],
+    ',': ['...', '...', '...', '.#.', '#..'],
+    '-': ['...', '...', '###', '...', '...'],
+    '.': ['...', '...', '...', '...', '.#.'],
+    '/': ['..#', '..#', '.#.', '#..', '#..'],
+    '0': ['###', '#.#', '#.#', '#.#', '###'],
+    '1': ['.#.', '##.', '.#.', '.#.', '###'],
+    '2': ['##.', '..#', '.#.', '#..', '###'],
+    '3': ['##.', '..#', '.#.', '..#', '##.'],
+    '4': ['#.#', '#.#', '###', '..#', '..#'],
+    '5': ['###', '#..', '##.', '..#', '##.'],
+    '6': ['.##', '#..', '###', '#.#', '###'],
+    '7': ['###', '..#', '.#.', '.#.', '.#.'],
+    '8': ['###', '#.#', '###', '#.#', '###'],
+    '9': ['###', '#.#', '###', '..#', '##.'],
+    ':': ['...', '.#.', '...', '.#.', '...'],
+    ';': ['...', '.#.', '...', '.#.', '#..'],
+    '<': ['..#', '.#.', '#..', '.#.', '..#'],
+    '=': ['...', '###', '...', '###', '...'],
+    '>': ['#..', '.#.', '..#', '.#.', '#..'],
+    '?': ['##.', '..#', '.#.', '...', '.#.'],
+    '@': ['.#.', '#.#', '#.#', '#..', '.##'],
+    'A': ['.#.', '#.#', '###', '#.#', '#.#'],
+    'B': ['##.', '#.#', '##.', '#.#', '##.'],
+    'C': ['.##', '#..', '#..', '#..', '.##'],
+    'D': ['##.', '#.#', '#.#', '#.#', '##.'],
+    'E': ['###', '#..', '###', '#..', '###'],
+    'F': ['###', '#..', '###', '#..', '#..'],
+    'G': ['.##', '#..', '#.#', '#.#', '.##'],
+    'H': ['#.#', '#.#', '###', '#.#', '#.#'],
+    'I': ['###', '.#.', '.#.', '.#.', '###'],
+    'J': ['..#', '..#', '..#', '#.#', '.#.'],
+    'K': ['#.#', '#.#', '##.', '#.#', '#.#'],
+    'L': ['#..', '#..', '#..', '#..', '###'],
+    'M': ['#.#', '###', '###', '#.#', '#.#'],
+    'N': ['##.', '#.#', '#.#', '#.#', '#.#'],
+    'O': ['.#.', '#.#', '#.#', '#.#', '.#.'],
+    'P': ['##.', '#.#', '##.', '#..', '#..'],
+    'Q': ['.#.', '#.#', '#.#', '##.', '.##'],
+    'R': ['##.', '#.#', '##.', '#.#', '#.#'],
+    'S': ['.##', '#..', '.#.', '..#', '##.'],
+    'T': ['###', '.#.', '.#.', '.#.', '.#.'],
+    'U': ['#.#', '#.#', '#.#', '#.#', '###'],
+    'V': ['#.#', '#.#', '#.#', '#.#', '.#.'],
+    'W': ['#.#', '#.#', '###', '###', '#.#'],
+    'X': ['#.#', '#.#', '.#.', '#.#', '#.#'],
+    'Y': ['#.#', '#.#', '.#.', '.#.', '.#.'],
+    'Z': ['###', '..#', '.#.', '#..', '###'],
+    '[': ['##.', '#..', '#..', '#..', '##.'],
+    '\\': ['#..', '#..', '.#.', '..#', '..#'],
+    ']': ['.##', '..#', '..#', '..#', '.##'],
+    '^': ['.#.', '#.#', '...', '...', '...'],
+    '_': ['...', '...', '...', '...', '###'],
+    '`': ['#..', '.#.', '...', '...', '...'],
+    '{': ['.##', '.#.', '##.', '.#.', '.##'],
+    '|': ['.#.', '.#.', '.#.', '.#.', '.#.'],
+    '}': ['##.', '.#.', '.##', '.#.', '##.'],
+    '~': ['...', '.##', '##.', '...', '...'],
+}
+
+# name, source font, variant, direction
+FONTS = [
+    ('Font_5x8',        '5x8', 'upright', 'FONT_RIGHT'),
+    ('Font_5x8_Prop',   '5x8', 'prop',    'FONT_RIGHT'),
+    ('Font_5x8_Upside', '5x8', 'upside',  'FONT_LEFT'),
+    ('Font_5x8_Mirror', '5x8', 'mirror',  'FONT_LEFT'),
+    ('Font_5x8_Down',   '5x8', 'down',    'FONT_DOWN'),
+    ('Font_5x8_Up',     '5x8', 'up',      'FONT_UP'),
+    ('Font_3x5',        '3x5', 'upright', 'FONT_RIGHT'),
+    ('Font_3x5_Prop',   '3x5', 'prop',    'FONT_RIGHT'),
+]
+
+ASCII = re.compile(r'ASCII\s*\[\s*\]\s*\[\s*5\s*\]\s*=\s*\{(.*?)\};', re.S)
+
+
+def load_5x8(path):
+    """Returns (first, height, glyphs), a glyph being a list of columns of pixels."""
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+    table = ASCII.search(text)
+    if not table:
+        sys.exit('%s: no ASCII table' % path)
+
+    glyphs = []
+    for line in table.group(1).split('\n'):
+        line = line.split('//')[0]              # Commented-out glyphs and the character names
+        values = [int(tok, 16) for tok in re.findall(r'0[xX][0-9a-fA-F]+', line)]
+        if len(values) == 5:
+            glyphs.append([[(v >> y) & 1 for y in range(8)] for v in [0] + values + [0]])
+    return 0x20, 8, glyphs
+
+
+def load_3x5():
+    glyphs = []
+    for code in range(0x20, 0x7F):
+        c = chr(code)
+        rows = SMALL.get(c.upper() if c.islower() else c)
+        rows = rows + ['...']                   # Blank row between lines of text
+        glyphs.append([[int(rows[y][x] == '#') for y in range(6)] for x in range(3)] + [[0] * 6])
+    return 0x20, 6, glyphs
+
+
+def proportional(glyph, space):
+    """Trims the blank columns and keeps one after the glyph."""
+    lit = [x for x, col in enumerate(glyph) if any(col)]
+    if not lit:
+        return [[0] * len(glyph[0])] * space
+    return glyph[lit[0]:lit[-1] + 1] + [[0] * len(glyph[0])]
+
+
+def turn(glyph, variant):
+    """glyph[x][y] to the pixels of the variant, same indexing."""
+    w, h = len(glyph), len(glyph[0])
+    if variant == 'upside':
+        return [[glyph[w - 1 - x][h - 1 - y] for y in range(h)] for x in range(w)]
+    if variant == 'mirror':
+        return [[glyph[w - 1 - x][y] for y in range(h)] for x in range(w)]
+    if variant == 'down':                       # (x, y) goes to (h - 1 - y, x)
+        return [[glyph[y][h - 1 - x] for y in range(w)] for x in range(h)]
+    if variant == 'up':                         # (x, y) goes to (y, w - 1 - x)
+        return [[glyph[w - 1 - y][x] for y in range(w)] for x in range(h)]
+    return glyph
+
+
+def banks(glyph):
+    w, h = len(glyph), len(glyph[0])
+    out = []
+    for bank in range((h + 7) // 8):
+        for x in range(w):
+            out.append(sum(glyph[x][y] << (y - bank * 8) for y in range(bank * 8, min(h, bank * 8 + 8))))
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    ap.add_argument('source', nargs='?', default='Symbols.h')
+    ap.add_argument('output', nargs='?', default='fonts', help='output base name (.c and .h are added)')
+    args = ap.parse_args()
+
+    sources = {'5x8': load_5x8(args.source), '3x5': load_3x5()}
+    spaces = {'5x8': 3, '3x5': 2}
+
+    base = args.output.split('/')[-1]
+    src = ['// Generated by tools/fontgen.py from %s -- do not edit.' % args.source,
+           '// Glyph tables for Font_PrintChar and Font_Print, one per font and orientation.',
+           '',
+           '#include "%s.h"' % base,
+           '']
+    hdr = ['// Generated by tools/fontgen.py from %s -- do not edit.' % args.source,
+           '',
+           '#ifndef %s_H' % base.upper(),
+           '#define %s_H' % base.upper(),
+           '',
+           '#include "Font.h"',
+           '']
+
+    for name, font, variant, direction in FONTS:
+        first, height, glyphs = sources[font]
+        data, offsets, advances = [], [], []
+
+        for glyph in glyphs:
+            if variant == 'prop':
+                glyph = proportional(glyph, spaces[font])
+            advances.append(len(glyph))         # Columns of the upright glyph: its length along the text
+            offsets.append(len(data))
+            data += banks(turn(glyph, variant))
+
+        mono = len(set(advances)) == 1
+
+        src.append('static const uint8_t %s_data[] = {    // %d bytes' % (name, len(data)))
+        for i in range(0, len(data), 16):
+            src.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+        src += ['};', '']
+
+        if mono:                                # Glyph i is at i * stride, every advance is the same
+            advance, stride, tables = advances[0], len(data) // len(glyphs), '0, 0'
+        else:
+            advance, stride, tables = 0, 0, '%s_offset, %s_advance' % (name, name)
+            src.append('static const uint16_t %s_offset[] = {' % name)
+            for i in range(0, len(offsets), 12):
+                src.append('    ' + ', '.join('%d' % o for o in offsets[i:i + 12]) + ',')
+            src += ['};', '']
+            src.append('static const uint8_t %s_advance[] = {' % name)
+            for i in range(0, len(advances), 16):
+                src.append('    ' + ', '.join('%d' % a for a in advances[i:i + 16]) + ',')
+            src += ['};', '']
+
+        src += ['const Font %s =' % name,
+                '{',
+                '    0x%02X, %d, %d, %d, %d, %s,' % (first, len(glyphs), height, advance, stride, direction),
+                '    %s_data, %s' % (name, tables),
+                '};',
+                '']
+        hdr.append('extern const Font %-18s// %s, %s' % (name + ';', font, variant))
+
+        size = len(data) + (0 if mono else 3 * len(glyphs))
+        print('%-18s %5d bytes' % (name, size))
+
+    hdr += ['', '#endif', '']
+
+    with open(args.output + '.c', 'w') as f:
+        f.write('\n'.join(src))
+    with open(args.output + '.h', 'w') as f:
+        f.write('\n'.join(hdr))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""
+Generates the move sets of Move.c: the moves of each set as enum ids tied to
+their sprites, the outcome of every pair of moves and the opponent's move for
+each second of the RTC minute. The game resolves a round with one load from
+the outcome table, whatever the size of the set.
+
+A set lists its moves in the order of their ids. Each move has its skill bar
+and choice sprites, the HP it takes off when it wins, and for a special move
+the ids it beats. The regular moves, without a list, go round a cycle: each
+beats the (n - 1) / 2 regular moves before it, wrapping around, so every one
+beats as many as it loses to, for 3, 5 or 7 moves alike. A special move
+(per character, say) beats the moves it lists and loses to the regular moves
+it leaves out; two special moves draw unless one lists the other.
+
+The game plays GAME_SET on the SKILL_BAR slots of the fight scene (main.c),
+so that set must have exactly as many moves; a bigger set needs its icons
+and a wider bar first. The other sets are free in size.
+
+Pick rules for the opponent's move, from the RTC seconds s:
+    modulo  s % count
+    skills  0 when s % 5 == 0, 1 when s is even, 2 otherwise: the rule the
+            game always had, so recorded sessions (Replay.c) play the same
+
+Usage (from the project root, after editing the sets below):
+    python3 tools/movegen.py [moves]
+writes moves.c and moves.h and prints the flash per set.
+"""
+
+import argparse
+import sys
+
+# name, id prefix, pick rule, moves: (id suffix, icon, choice, damage, beats)
+SETS = [
+    ('MoveSet_Skills', 'MOVE_SKILL', 'skills', [
+        ('1', 'Sprite_SKILL_1', 'Sprite_SKILL_1_TEMP', 1, None),
+        ('2', 'Sprite_SKILL_2', 'Sprite_SKILL_2_TEMP', 1, None),
+        ('3', 'Sprite_SKILL_3', 'Sprite_SKILL_3_TEMP', 1, None),
+    ]),
+]
+
+GAME_SET = 'MoveSet_Skills'
+SKILL_BAR = 3
+
+MINUTE = 60
+RESULTS = ('MOVE_LOSE', 'MOVE_WIN', 'MOVE_DRAW')
+
+
+def beats(moves):
+    """Set of (winner, loser) ids."""
+    count = len(moves)
+    regular = [i for i, move in enumerate(moves) if move[4] is None]
+    wins = set()
+    for k, i in enumerate(regular):
+        for back in range(1, (len(regular) - 1) // 2 + 1):
+            wins.add((i, regular[(k - back) % len(regular)]))
+    for i, (_, _, _, _, listed) in enumerate(moves):
+        if listed is None:
+            continue
+        for j in listed:
+            if not 0 <= j < count or j == i:
+                sys.exit('move %d cannot beat %r' % (i, j))
+            wins.add((i, j))
+        wins.update((j, i) for j in regular if j not in listed)
+    for i, j in wins:
+        if (j, i) in wins:
+            sys.exit('moves %d and %d beat each other' % (i, j))
+    return wins
+
+
+def outcomes(moves):
+    """Row by row, (result, damage) for the player's move against the opponent's."""
+    wins = beats(moves)
+    table = []
+    for i in range(len(moves)):
+        for j in range(len(moves)):
+            if (i, j) in wins:
+                table.append((1, moves[i][3]))
+            elif (j, i) in wins:
+                table.append((0, moves[j][3]))
+            else:
+                table.append((2, 0))
+    return table
+
+
+def picks(rule, count):
+    if rule == 'modulo':
+        return [s % count for s in range(MINUTE)]
+    if rule == 'skills':
+        return [0 if s % 5 == 0 else 1 if s % 2 == 0 else 2 for s in range(MINUTE)]
+    sys.exit('unknown pick rule %r' % rule)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    ap.add_argument('output', nargs='?', default='moves', help='output base name (.c and .h are added)')
+    args = ap.parse_args()
+
+    base = args.output.split('/')[-1]
+    src = ['// Generated by tools/movegen.py -- do not edit.',
+           '// Moves, outcome tables and opponent picks for Move_Resolve and Move_Pick.',
+           '',
+           '#include "%s.h"' % base,
+           '#include "sprites.h"',
+           '']
+    hdr = ['// Generated by tools/movegen.py -- do not edit.',
+           '',
+           '#ifndef %s_H' % base.upper(),
+           '#define %s_H' % base.upper(),
+           '',
+           '#include "Move.h"',
+           '']
+
+    for name, prefix, rule, moves in SETS:
+        count = len(moves)
+        ids = ['%s_%s' % (prefix, move[0]) for move in moves]
+        total = prefix + 'S'
+        chosen = picks(rule, count)
+        if max(chosen) >= count:
+            sys.exit('%s: rule %s picks moves it does not have' % (name, rule))
+        if name == GAME_SET and count != SKILL_BAR:
+            sys.exit('%s: %d moves, the skill bar has %d slots' % (name, count, SKILL_BAR))
+
+        hdr.append('// %s: %d moves' % (name, count))
+        hdr += ['enum', '{'] + ['    %s,' % i for i in ids] + ['    %s' % total, '};', '']
+        hdr.append('extern const MoveSet %s;' % name)
+        hdr.append('')
+
+        src.append('static const Move %s_moves[%s] = {' % (name, total))
+        for move in moves:
+            src.append('    {&%s, &%s},' % (move[1], move[2]))
+        src += ['};', '']
+
+        table = outcomes(moves)
+        src.append('// Row: the player\'s move, column: the opponent\'s')
+        src.append('static const MoveOutcome %s_outcomes[%s * %s] = {' % (name, total, total))
+        for i in range(count):
+            row = table[i * count:(i + 1) * count]
+            src.append('    ' + ' '.join('{%s, %d},' % (RESULTS[r], d) for r, d in row) + '    // ' + ids[i])
+        src += ['};', '']
+
+        src.append('static const uint8_t %s_picks[%d] = {' % (name, MINUTE))
+        for i in range(0, MINUTE, 20):
+            src.append('    ' + ', '.join('%d' % p for p in chosen[i:i + 20]) + ',')
+        src += ['};', '']
+
+        src += ['const MoveSet %s =' % name,
+                '{',
+                '    %s, %s_moves, %s_outcomes, %s_picks' % (total, name, name, name),
+                '};',
+                '']
+
+        size = 8 * count + 2 * count * count + MINUTE
+        print('%-18s %2d moves %5d bytes' % (name, count, size))
+
+    hdr += ['#endif', '']
+
+    with open(args.output + '.c', 'w') as f:
+        f.write('\n'.join(src))
+    with open(args.output + '.h', 'w') as f:
+        f.write('\n'.join(hdr))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""
+Compresses the 504-byte full-screen images of bitmaps.h for
+Nokia5110_DrawCompressedImage and reports the ratio of each one.
+
+Format (PackBits style), repeated until 504 bytes have been produced:
+    0x00-0x7F  n   copy the next n + 1 bytes
+    0x80-0xFF  n   repeat the next byte (n - 0x80) + 3 times
+
+Usage (from the project root, after editing bitmaps.h):
+    python3 tools/rle_screens.py [bitmaps.h] [screens]
+writes screens.c and screens.h.
+"""
+
+import argparse
+import re
+import sys
+
+FRAMEBYTES = 84 * 48 // 8
+MIN_RUN, MAX_RUN, MAX_LITERAL = 3, 0x7F + 3, 0x80
+
+ARRAY = re.compile(r'const\s+(?:unsigned\s+char|uint8_t)\s+(\w+)\s*\[\s*\]\s*=\s*\{(.*?)\};', re.S)
+
+
+def encode(data):
+    out, literal, i = [], [], 0
+
+    def flush():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    while i < len(data):
+        run = 1
+        while i + run < len(data) and data[i + run] == data[i] and run < MAX_RUN:
+            run += 1
+        if run >= MIN_RUN:
+            flush()
+            out += [0x80 + run - MIN_RUN, data[i]]
+            i += run
+        else:
+            literal.append(data[i])
+            i += 1
+    flush()
+    return out
+
+
+def decode(packed):
+    out, i = [], 0
+    while len(out) < FRAMEBYTES:
+        c = packed[i]
+        if c & 0x80:
+            out += [packed[i + 1]] * (c - 0x80 + MIN_RUN)
+            i += 2
+        else:
+            out += packed[i + 1:i + 2 + c]
+            i += c + 2
+    return out
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split('\n\n')[0])
+    ap.add_argument('source', nargs='?', default='bitmaps.h')
+    ap.add_argument('output', nargs='?', default='screens', help='output base name (.c and .h are added)')
+    args = ap.parse_args()
+
+    with open(args.source) as f:
+        text = f.read()
+
+    src = ['// Generated by tools/rle_screens.py from %s -- do not edit.' % args.source,
+           '// Run-length encoded full screens, drawn with Nokia5110_DrawCompressedImage.',
+           '',
+           '#include "%s.h"' % args.output.split('/')[-1],
+           '']
+    hdr = ['// Generated by tools/rle_screens.py from %s -- do not edit.' % args.source,
+           '',
+           '#ifndef SCREENS_H',
+           '#define SCREENS_H',
+           '',
+           '#include <stdint.h>',
+           '']
+
+    total_raw = total_rle = 0
+    for name, body in ARRAY.findall(text):
+        data = [int(tok, 16) for tok in re.findall(r'0[xX][0-9a-fA-F]+', body)]
+        if len(data) != FRAMEBYTES or data[:2] == [0x42, 0x4D]:
+            continue                            # Sprites are handled by bmp2sprite.py
+
+        packed = encode(data)
+        if decode(packed) != data:
+            sys.exit('%s: round trip failed' % name)
+
+        src.append('const uint8_t %s_rle[] = {    // %d -> %d bytes' % (name, len(data), len(packed)))
+        for i in range(0, len(packed), 16):
+            src.append('    ' + ', '.join('0x%02X' % b for b in packed[i:i + 16]) + ',')
+        src += ['};', '']
+        hdr.append('extern const uint8_t %s_rle[];' % name)
+
+        total_raw += len(data)
+        total_rle += len(packed)
+        print('%-22s %4d -> %4d bytes  %5.2f:1' % (name, len(data), len(packed), float(len(data)) / len(packed)))
+
+    hdr += ['', '#endif', '']
+    print('%-22s %4d -> %4d bytes  %5.2f:1' % ('total', total_raw, total_rle, float(total_raw) / total_rle))
+
+    with open(args.output + '.c', 'w') as f:
+        f.write('\n'.join(src))
+    with open(args.output + '.h', 'w') as f:
+        f.write('\n'.join(hdr))
+
+
+if __name__ == '__main__':
+    main()